@@ -1,5 +1,7 @@
 ##############################################################################
-ifndef EMSCRIPTEN
+ifdef HOST
+BUILD = ./build-host
+else ifndef EMSCRIPTEN
 BUILD = ./build
 else
 BUILD = ./build-sim
@@ -57,7 +59,60 @@ ifeq ($(DETECTED_OS), WINDOWS)
   MAKEFLAGS += -j $(NUMBER_OF_PROCESSORS)
 endif
 
-ifndef EMSCRIPTEN
+ifdef HOST
+
+# Native build: runs Movement headless against a virtual clock, e.g. make HOST=1 COLOR=GREEN
+CFLAGS += -W -Wall -Wextra -Wmissing-prototypes -Wmissing-declarations
+CFLAGS += -Wno-format -Wno-unused-parameter
+CFLAGS += --std=gnu99 -O2 -g
+CFLAGS += -funsigned-char -funsigned-bitfields
+CFLAGS += -MD -MP -MT $(BUILD)/$(*F).o -MF $(BUILD)/$(@F).d
+
+LIBS += -lm
+
+INCLUDES += \
+  -I$(TOP)/boards/$(BOARD) \
+  -I$(TOP)/watch-library/shared/driver/ \
+  -I$(TOP)/watch-library/shared/config/ \
+  -I$(TOP)/watch-library/shared/watch/ \
+  -I$(TOP)/watch-library/host/watch/ \
+  -I$(TOP)/watch-library/simulator/hpl/port/ \
+  -I$(TOP)/watch-library/hardware/include/component \
+  -I$(TOP)/watch-library/hardware/hal/include/ \
+  -I$(TOP)/watch-library/hardware/hal/utils/include/ \
+  -I$(TOP)/watch-library/hardware/hpl/slcd/ \
+  -I$(TOP)/watch-library/hardware/hw/ \
+
+SRCS += \
+  $(TOP)/watch-library/host/main.c \
+  $(TOP)/watch-library/host/watch/watch_rtc.c \
+  $(TOP)/watch-library/host/watch/watch_slcd.c \
+  $(TOP)/watch-library/host/watch/watch_extint.c \
+  $(TOP)/watch-library/host/watch/watch_led.c \
+  $(TOP)/watch-library/host/watch/watch_buzzer.c \
+  $(TOP)/watch-library/host/watch/watch_adc.c \
+  $(TOP)/watch-library/host/watch/watch_gpio.c \
+  $(TOP)/watch-library/host/watch/watch_i2c.c \
+  $(TOP)/watch-library/host/watch/watch_spi.c \
+  $(TOP)/watch-library/host/watch/watch_uart.c \
+  $(TOP)/watch-library/host/watch/watch_storage.c \
+  $(TOP)/watch-library/host/watch/watch_deepsleep.c \
+  $(TOP)/watch-library/host/watch/watch_perf.c \
+  $(TOP)/watch-library/host/watch/watch_private.c \
+  $(TOP)/watch-library/host/watch/watch.c \
+  $(TOP)/watch-library/shared/driver/thermistor_driver.c \
+  $(TOP)/watch-library/shared/driver/lis2dw.c \
+  $(TOP)/watch-library/shared/driver/opt3001.c \
+  $(TOP)/watch-library/shared/driver/spiflash.c \
+  $(TOP)/watch-library/shared/watch/watch_private_display.c \
+  $(TOP)/watch-library/shared/watch/watch_utility.c \
+
+# _UNIT_TEST_ keeps the ASF headers from pulling in the SAM L22 register definitions.
+DEFINES += \
+  -DWATCH_HOST \
+  -D_UNIT_TEST_
+
+else ifndef EMSCRIPTEN
 CC = arm-none-eabi-gcc
 OBJCOPY = arm-none-eabi-objcopy
 SIZE = arm-none-eabi-size
@@ -75,6 +130,7 @@ LDFLAGS += -mcpu=cortex-m0plus -mthumb
 LDFLAGS += -Wl,--gc-sections
 LDFLAGS += -Wl,--script=$(TOP)/watch-library/hardware/linker/saml22j18.ld
 LDFLAGS += -Wl,--print-memory-usage
+LDFLAGS += -Wl,--wrap=_delay_cycles
 
 LIBS += -lm
 
@@ -132,6 +188,7 @@ SRCS += \
   $(TOP)/watch-library/hardware/watch/watch_uart.c \
   $(TOP)/watch-library/hardware/watch/watch_storage.c \
   $(TOP)/watch-library/hardware/watch/watch_deepsleep.c \
+  $(TOP)/watch-library/hardware/watch/watch_perf.c \
   $(TOP)/watch-library/hardware/watch/watch_private.c \
   $(TOP)/watch-library/hardware/watch/watch_private_cdc.c \
   $(TOP)/watch-library/hardware/watch/watch.c \
@@ -206,6 +263,7 @@ SRCS += \
   $(TOP)/watch-library/simulator/watch/watch_uart.c \
   $(TOP)/watch-library/simulator/watch/watch_storage.c \
   $(TOP)/watch-library/simulator/watch/watch_deepsleep.c \
+  $(TOP)/watch-library/simulator/watch/watch_perf.c \
   $(TOP)/watch-library/simulator/watch/watch_private.c \
   $(TOP)/watch-library/simulator/watch/watch.c \
   $(TOP)/watch-library/shared/driver/thermistor_driver.c \
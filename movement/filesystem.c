@@ -32,7 +32,12 @@ int lfs_storage_sync(const struct lfs_config *cfg) {
     return !watch_storage_sync();
 }
 
+#ifdef WATCH_HOST
+// the host build's benchmark tries out other configurations; see _filesystem_host_configure.
+static struct lfs_config cfg = {
+#else
 const struct lfs_config cfg = {
+#endif
     // block device operations
     .read  = lfs_storage_read,
     .prog  = lfs_storage_prog,
@@ -53,6 +58,39 @@ static lfs_t lfs;
 static lfs_file_t file;
 static struct lfs_info info;
 
+typedef struct {
+    lfs_file_t file;
+    struct lfs_file_config config;
+    uint32_t cache[NVMCTRL_PAGE_SIZE / sizeof(uint32_t)]; // cfg.cache_size bytes
+    bool is_open;
+} filesystem_handle_t;
+
+static filesystem_handle_t handles[FILESYSTEM_MAX_OPEN_FILES];
+
+typedef enum {
+    FILESYSTEM_QUEUED_WRITE = 0,
+    FILESYSTEM_QUEUED_APPEND,
+    FILESYSTEM_QUEUED_WRITE_AT,
+} filesystem_queued_op_t;
+
+// A write waiting in the queue. The file name and its terminator follow the header, and then the data; the
+// next write starts at the next 4-byte boundary.
+typedef struct {
+    uint8_t op;
+    uint8_t name_length;    // including the terminator
+    uint16_t length;
+    int32_t offset;         // for FILESYSTEM_QUEUED_WRITE_AT
+} filesystem_queued_write_t;
+
+static uint8_t write_queue[FILESYSTEM_WRITE_QUEUE_SIZE] __attribute__((aligned(4)));
+static uint16_t write_queue_used;
+
+static bool _filesystem_write_file_now(char *filename, char *text, int32_t length);
+static bool _filesystem_append_file_now(char *filename, char *text, int32_t length);
+static bool _filesystem_write_at_now(char *filename, int32_t offset, char *data, int32_t length);
+static void _filesystem_flush_file(char *filename);
+static bool _filesystem_write_next(void);
+
 static int _traverse_df_cb(void *p, lfs_block_t block) {
     (void) block;
 	uint32_t *nb = p;
@@ -63,6 +101,7 @@ static int _traverse_df_cb(void *p, lfs_block_t block) {
 int32_t filesystem_get_free_space(void) {
 	int err;
 
+	filesystem_flush();
 	uint32_t free_blocks = 0;
 	err = lfs_fs_traverse(&lfs, _traverse_df_cb, &free_blocks);
 	if(err < 0){
@@ -129,6 +168,12 @@ bool filesystem_init(void) {
 
 int _filesystem_format(void);
 int _filesystem_format(void) {
+    // anything still queued would only be written to the fresh filesystem.
+    write_queue_used = 0;
+    for (filesystem_file_t fd = 0; fd < FILESYSTEM_MAX_OPEN_FILES; fd++) {
+        if (handles[fd].is_open) filesystem_close(fd);
+    }
+
     int err = lfs_unmount(&lfs);
     if (err < 0) {
         printf("Couldn't unmount - continuing to format, but you should reboot afterwards!\r\n");
@@ -143,13 +188,35 @@ int _filesystem_format(void) {
     return 0;
 }
 
+#ifdef WATCH_HOST
+int _filesystem_host_configure(lfs_size_t read_size, lfs_size_t prog_size, lfs_size_t lookahead_size, int32_t block_cycles) {
+    write_queue_used = 0;
+    for (filesystem_file_t fd = 0; fd < FILESYSTEM_MAX_OPEN_FILES; fd++) {
+        if (handles[fd].is_open) filesystem_close(fd);
+    }
+    lfs_unmount(&lfs);
+
+    cfg.read_size = read_size;
+    cfg.prog_size = prog_size;
+    cfg.lookahead_size = lookahead_size;
+    cfg.block_cycles = block_cycles;
+
+    int err = lfs_format(&lfs, &cfg);
+    if (err < 0) return err;
+
+    return lfs_mount(&lfs, &cfg);
+}
+#endif
+
 bool filesystem_file_exists(char *filename) {
+    _filesystem_flush_file(filename);
     info.type = 0;
     lfs_stat(&lfs, filename, &info);
     return info.type == LFS_TYPE_REG;
 }
 
 bool filesystem_rm(char *filename) {
+    _filesystem_flush_file(filename);
     info.type = 0;
     lfs_stat(&lfs, filename, &info);
     if (filesystem_file_exists(filename)) {
@@ -168,6 +235,66 @@ int32_t filesystem_get_file_size(char *filename) {
     return -1;
 }
 
+static lfs_file_t *_filesystem_get_file(filesystem_file_t fd) {
+    if (fd < 0 || fd >= FILESYSTEM_MAX_OPEN_FILES || !handles[fd].is_open) return NULL;
+    return &handles[fd].file;
+}
+
+filesystem_file_t filesystem_open(char *filename, int flags) {
+    _filesystem_flush_file(filename);
+    for (filesystem_file_t fd = 0; fd < FILESYSTEM_MAX_OPEN_FILES; fd++) {
+        filesystem_handle_t *handle = &handles[fd];
+        if (handle->is_open) continue;
+
+        // littlefs would otherwise malloc a cache for every file it opens.
+        memset(&handle->config, 0, sizeof(handle->config));
+        handle->config.buffer = handle->cache;
+        if (lfs_file_opencfg(&lfs, &handle->file, filename, flags, &handle->config) < 0) return FILESYSTEM_NO_FILE;
+        handle->is_open = true;
+        return fd;
+    }
+
+    printf("%s: Too many open files\r\n", filename);
+    return FILESYSTEM_NO_FILE;
+}
+
+int32_t filesystem_read(filesystem_file_t fd, void *buf, int32_t length) {
+    lfs_file_t *f = _filesystem_get_file(fd);
+    if (f == NULL) return LFS_ERR_BADF;
+    return lfs_file_read(&lfs, f, buf, length);
+}
+
+int32_t filesystem_write(filesystem_file_t fd, const void *data, int32_t length) {
+    lfs_file_t *f = _filesystem_get_file(fd);
+    if (f == NULL) return LFS_ERR_BADF;
+    return lfs_file_write(&lfs, f, data, length);
+}
+
+int32_t filesystem_seek(filesystem_file_t fd, int32_t offset, int whence) {
+    lfs_file_t *f = _filesystem_get_file(fd);
+    if (f == NULL) return LFS_ERR_BADF;
+    return lfs_file_seek(&lfs, f, offset, whence);
+}
+
+int32_t filesystem_size(filesystem_file_t fd) {
+    lfs_file_t *f = _filesystem_get_file(fd);
+    if (f == NULL) return LFS_ERR_BADF;
+    return lfs_file_size(&lfs, f);
+}
+
+bool filesystem_sync(filesystem_file_t fd) {
+    lfs_file_t *f = _filesystem_get_file(fd);
+    if (f == NULL) return false;
+    return lfs_file_sync(&lfs, f) == LFS_ERR_OK;
+}
+
+bool filesystem_close(filesystem_file_t fd) {
+    lfs_file_t *f = _filesystem_get_file(fd);
+    if (f == NULL) return false;
+    handles[fd].is_open = false;
+    return lfs_file_close(&lfs, f) == LFS_ERR_OK;
+}
+
 bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     memset(buf, 0, length);
     int32_t file_size = filesystem_get_file_size(filename);
@@ -183,26 +310,79 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
 }
 
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length) {
+    filesystem_line_reader_t reader;
     memset(buf, 0, length + 1);
-    int32_t file_size = filesystem_get_file_size(filename);
-    if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
-        if (err < 0) return false;
-        err = lfs_file_seek(&lfs, &file, *offset, LFS_SEEK_SET);
-        if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length - 1, file_size - *offset));
-        if (err < 0) return false;
-        for(int i = 0; i < length; i++) {
-            (*offset)++;
-            if (buf[i] == '\n') {
-                buf[i] = 0;
-                break;
-            }
-        }
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    if (!filesystem_open_line_reader(&reader, filename)) return false;
+    bool success = filesystem_line_reader_seek(&reader, *offset) && filesystem_read_next_line(&reader, buf, length);
+    *offset = filesystem_line_reader_tell(&reader);
+    filesystem_close_line_reader(&reader);
+    return success;
+}
+
+bool filesystem_open_line_reader(filesystem_line_reader_t *reader, char *filename) {
+    reader->offset = 0;
+    reader->start = 0;
+    reader->end = 0;
+    reader->file = filesystem_open(filename, LFS_O_RDONLY);
+    return reader->file != FILESYSTEM_NO_FILE;
+}
+
+static bool _filesystem_line_reader_fill(filesystem_line_reader_t *reader) {
+    int32_t bytes_read = filesystem_read(reader->file, reader->buf, sizeof(reader->buf));
+    if (bytes_read <= 0) return false;
+    reader->start = 0;
+    reader->end = bytes_read;
+    return true;
+}
+
+bool filesystem_read_next_line(filesystem_line_reader_t *reader, char *buf, int32_t length) {
+    int32_t line_length = 0;
+    bool found_line = false;
+
+    while (reader->start < reader->end || _filesystem_line_reader_fill(reader)) {
+        found_line = true;
+        char *chunk = reader->buf + reader->start;
+        uint16_t available = reader->end - reader->start;
+        char *newline = memchr(chunk, '\n', available);
+        uint16_t chunk_length = newline == NULL ? available : newline - chunk;
+
+        // copy what fits, and skip over the rest of an overlong line.
+        int32_t to_copy = min(chunk_length, length - line_length);
+        memcpy(buf + line_length, chunk, to_copy);
+        line_length += to_copy;
+
+        uint16_t consumed = chunk_length + (newline != NULL);
+        reader->start += consumed;
+        reader->offset += consumed;
+        if (newline != NULL) break;
     }
+    buf[line_length] = 0;
 
-    return false;
+    return found_line;
+}
+
+int32_t filesystem_line_reader_tell(filesystem_line_reader_t *reader) {
+    return reader->offset;
+}
+
+bool filesystem_line_reader_seek(filesystem_line_reader_t *reader, int32_t offset) {
+    // if the offset is still in the buffer, there's no need to go back to the file.
+    int32_t buffer_offset = reader->offset - reader->start;
+    if (offset >= buffer_offset && offset <= buffer_offset + reader->end) {
+        reader->start = offset - buffer_offset;
+        reader->offset = offset;
+        return true;
+    }
+
+    reader->start = 0;
+    reader->end = 0;
+    if (filesystem_seek(reader->file, offset, LFS_SEEK_SET) < 0) return false;
+    reader->offset = offset;
+    return true;
+}
+
+void filesystem_close_line_reader(filesystem_line_reader_t *reader) {
+    filesystem_close(reader->file);
 }
 
 static void filesystem_cat(char *filename) {
@@ -223,7 +403,7 @@ static void filesystem_cat(char *filename) {
     }
 }
 
-bool filesystem_write_file(char *filename, char *text, int32_t length) {
+static bool _filesystem_write_file_now(char *filename, char *text, int32_t length) {
     int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
     if (err < 0) return false;
     err = lfs_file_write(&lfs, &file, text, length);
@@ -231,7 +411,36 @@ bool filesystem_write_file(char *filename, char *text, int32_t length) {
     return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
 }
 
-bool filesystem_append_file(char *filename, char *text, int32_t length) {
+static bool _filesystem_write_at_now(char *filename, int32_t offset, char *data, int32_t length) {
+    int err = lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT);
+    if (err < 0) return false;
+    err = lfs_file_seek(&lfs, &file, offset, LFS_SEEK_SET);
+    if (err >= 0) err = lfs_file_write(&lfs, &file, data, length);
+    if (err < 0) {
+        lfs_file_close(&lfs, &file);
+        return false;
+    }
+    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+}
+
+void filesystem_mark_dirty(filesystem_dirty_range_t *range, int32_t offset, int32_t length) {
+    if (range->start == range->end) {
+        range->start = offset;
+        range->end = offset + length;
+    } else {
+        range->start = min(range->start, offset);
+        range->end = max(range->end, offset + length);
+    }
+}
+
+bool filesystem_write_dirty(char *filename, char *data, filesystem_dirty_range_t *range) {
+    if (range->start == range->end) return true;
+    if (!filesystem_write_at(filename, range->start, data + range->start, range->end - range->start)) return false;
+    range->start = range->end = 0;
+    return true;
+}
+
+static bool _filesystem_append_file_now(char *filename, char *text, int32_t length) {
     int err = lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
     if (err < 0) return false;
     err = lfs_file_write(&lfs, &file, text, length);
@@ -239,7 +448,147 @@ bool filesystem_append_file(char *filename, char *text, int32_t length) {
     return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
 }
 
+static inline filesystem_queued_write_t *_filesystem_queued_write(uint16_t position) {
+    return (filesystem_queued_write_t *)(write_queue + position);
+}
+
+static inline char *_filesystem_queued_name(filesystem_queued_write_t *queued) {
+    return (char *)(queued + 1);
+}
+
+static inline char *_filesystem_queued_data(filesystem_queued_write_t *queued) {
+    return _filesystem_queued_name(queued) + queued->name_length;
+}
+
+static inline uint16_t _filesystem_queued_size(uint16_t name_length, int32_t length) {
+    return (sizeof(filesystem_queued_write_t) + name_length + length + 3) & ~3;
+}
+
+static void _filesystem_dequeue(uint16_t position) {
+    filesystem_queued_write_t *queued = _filesystem_queued_write(position);
+    uint16_t size = _filesystem_queued_size(queued->name_length, queued->length);
+    memmove(write_queue + position, write_queue + position + size, write_queue_used - position - size);
+    write_queue_used -= size;
+}
+
+static bool _filesystem_write_next(void) {
+    filesystem_queued_write_t *queued = _filesystem_queued_write(0);
+    char *filename = _filesystem_queued_name(queued);
+    char *data = _filesystem_queued_data(queued);
+    bool success;
+    switch (queued->op) {
+        case FILESYSTEM_QUEUED_WRITE:
+            success = _filesystem_write_file_now(filename, data, queued->length);
+            break;
+        case FILESYSTEM_QUEUED_APPEND:
+            success = _filesystem_append_file_now(filename, data, queued->length);
+            break;
+        default:
+            success = _filesystem_write_at_now(filename, queued->offset, data, queued->length);
+            break;
+    }
+    // the caller has long since moved on, and trying again is unlikely to go any better.
+    if (!success) printf("%s: Write failed\r\n", filename);
+    _filesystem_dequeue(0);
+
+    return success;
+}
+
+bool filesystem_service(void) {
+    if (write_queue_used) _filesystem_write_next();
+
+    return write_queue_used != 0;
+}
+
+bool filesystem_flush(void) {
+    bool success = true;
+    while (write_queue_used) success = _filesystem_write_next() && success;
+
+    return success;
+}
+
+static void _filesystem_flush_file(char *filename) {
+    // the queue goes out in order, so everything ahead of the file's last write goes out with it.
+    for (uint16_t position = 0; position < write_queue_used;) {
+        filesystem_queued_write_t *queued = _filesystem_queued_write(position);
+        if (!strcmp(_filesystem_queued_name(queued), filename)) {
+            filesystem_flush();
+            return;
+        }
+        position += _filesystem_queued_size(queued->name_length, queued->length);
+    }
+}
+
+static bool _filesystem_enqueue(filesystem_queued_op_t op, char *filename, int32_t offset, char *data, int32_t length) {
+    // check the length before working out the size, which would wrap for a write of 64 KiB or more.
+    if (length < 0 || length > FILESYSTEM_WRITE_QUEUE_SIZE) return false;
+    size_t name_length = strlen(filename) + 1;
+    if (name_length > UINT8_MAX) return false;
+    uint16_t size = _filesystem_queued_size(name_length, length);
+    if (size > FILESYSTEM_WRITE_QUEUE_SIZE) return false;
+
+    if (op == FILESYSTEM_QUEUED_WRITE) {
+        // a whole-file write makes any earlier write to the same file moot.
+        for (uint16_t position = 0; position < write_queue_used;) {
+            filesystem_queued_write_t *queued = _filesystem_queued_write(position);
+            if (!strcmp(_filesystem_queued_name(queued), filename)) _filesystem_dequeue(position);
+            else position += _filesystem_queued_size(queued->name_length, queued->length);
+        }
+    } else if (op == FILESYSTEM_QUEUED_APPEND && write_queue_used) {
+        // appending to the file the newest write is for can add to that write.
+        uint16_t last_position = 0, position = 0;
+        while (position < write_queue_used) {
+            filesystem_queued_write_t *queued = _filesystem_queued_write(position);
+            last_position = position;
+            position += _filesystem_queued_size(queued->name_length, queued->length);
+        }
+        filesystem_queued_write_t *last = _filesystem_queued_write(last_position);
+        uint16_t grown = _filesystem_queued_size(last->name_length, last->length + length);
+        if (last->op != FILESYSTEM_QUEUED_WRITE_AT && !strcmp(_filesystem_queued_name(last), filename) &&
+            last_position + grown <= FILESYSTEM_WRITE_QUEUE_SIZE) {
+            memcpy(_filesystem_queued_data(last) + last->length, data, length);
+            last->length += length;
+            write_queue_used = last_position + grown;
+            return true;
+        }
+    }
+
+    // make room by writing out the oldest writes.
+    while (write_queue_used + size > FILESYSTEM_WRITE_QUEUE_SIZE) _filesystem_write_next();
+
+    filesystem_queued_write_t *queued = _filesystem_queued_write(write_queue_used);
+    queued->op = op;
+    queued->name_length = name_length;
+    queued->length = length;
+    queued->offset = offset;
+    memcpy(_filesystem_queued_name(queued), filename, name_length);
+    memcpy(_filesystem_queued_data(queued), data, length);
+    write_queue_used += size;
+
+    return true;
+}
+
+bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    if (_filesystem_enqueue(FILESYSTEM_QUEUED_WRITE, filename, 0, text, length)) return true;
+    // too big to queue; write it out now, after anything queued ahead of it.
+    filesystem_flush();
+    return _filesystem_write_file_now(filename, text, length);
+}
+
+bool filesystem_append_file(char *filename, char *text, int32_t length) {
+    if (_filesystem_enqueue(FILESYSTEM_QUEUED_APPEND, filename, 0, text, length)) return true;
+    filesystem_flush();
+    return _filesystem_append_file_now(filename, text, length);
+}
+
+bool filesystem_write_at(char *filename, int32_t offset, char *data, int32_t length) {
+    if (_filesystem_enqueue(FILESYSTEM_QUEUED_WRITE_AT, filename, offset, data, length)) return true;
+    filesystem_flush();
+    return _filesystem_write_at_now(filename, offset, data, length);
+}
+
 int filesystem_cmd_ls(int argc, char *argv[]) {
+    filesystem_flush();
     if (argc >= 2) {
         filesystem_ls(&lfs, argv[1]);
     } else {
@@ -305,3 +654,9 @@ int filesystem_cmd_echo(int argc, char *argv[]) {
 
     return 0;
 }
+
+int filesystem_cmd_sync(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    return filesystem_flush() ? 0 : 1;
+}
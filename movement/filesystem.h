@@ -27,6 +27,41 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include "watch.h"
+#include "lfs.h"
+
+/// How many files can be open through filesystem_open at once. Each one keeps a cache buffer of its own.
+#ifndef FILESYSTEM_MAX_OPEN_FILES
+#define FILESYSTEM_MAX_OPEN_FILES 3
+#endif
+
+/** @brief How many bytes of writes can wait in RAM to be written out; see filesystem_service.
+  * @details Each queued write takes eight bytes, plus its file name and data, rounded up to four bytes.
+  */
+#ifndef FILESYSTEM_WRITE_QUEUE_SIZE
+#define FILESYSTEM_WRITE_QUEUE_SIZE 256
+#endif
+
+/// A handle to a file opened with filesystem_open.
+typedef int8_t filesystem_file_t;
+
+/// Returned by filesystem_open when the file could not be opened.
+#define FILESYSTEM_NO_FILE -1
+
+/// The size of a line reader's buffer. Lines can be longer than this; the buffer just refills as it goes.
+#define FILESYSTEM_LINE_READER_BUFFER_SIZE 64
+
+/** @brief A file open for reading line by line. Treat the fields as private; use the functions below.
+  * @details The file stays open between lines, and is read a buffer at a time instead of once per line, so
+  *          reading a whole file costs one open and about one read per FILESYSTEM_LINE_READER_BUFFER_SIZE
+  *          bytes, instead of an open, a seek and a read for every line.
+  */
+typedef struct {
+    filesystem_file_t file;
+    int32_t offset;     // offset into the file of buf[start], i.e. the start of the next line
+    uint16_t start;     // the next unread byte in buf
+    uint16_t end;       // the number of bytes in buf
+    char buf[FILESYSTEM_LINE_READER_BUFFER_SIZE];
+} filesystem_line_reader_t;
 
 /** @brief Initializes and mounts the tiny 8kb filesystem, formatting it if need be.
   * @return true if the filesystem was mounted successfully.
@@ -56,6 +91,59 @@ bool filesystem_rm(char *filename);
   */
 int32_t filesystem_get_file_size(char *filename);
 
+/** @brief Opens a file and keeps it open, so that it can be read or written many times without looking
+  *        it up again each time.
+  * @param filename the file you wish to open
+  * @param flags littlefs open flags, e.g. LFS_O_RDONLY, or LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND
+  * @return a handle to the file, or FILESYSTEM_NO_FILE if it could not be opened or if
+  *         FILESYSTEM_MAX_OPEN_FILES files are already open.
+  * @note Writes are only committed to flash when the file is synced or closed. A face that keeps a file open
+  *       across calls to its loop should sync it at a point where losing the data to a reset would matter.
+  */
+filesystem_file_t filesystem_open(char *filename, int flags);
+
+/** @brief Reads from an open file at its current position.
+  * @param file a handle returned by filesystem_open
+  * @param buf A buffer of at least length bytes
+  * @param length The maximum number of bytes to read
+  * @return the number of bytes read, which is 0 at the end of the file, or a negative error code.
+  */
+int32_t filesystem_read(filesystem_file_t file, void *buf, int32_t length);
+
+/** @brief Writes to an open file at its current position, or at the end if it was opened with LFS_O_APPEND.
+  * @param file a handle returned by filesystem_open
+  * @param data The bytes to write
+  * @param length The number of bytes to write
+  * @return the number of bytes written, or a negative error code.
+  */
+int32_t filesystem_write(filesystem_file_t file, const void *data, int32_t length);
+
+/** @brief Moves an open file's position.
+  * @param file a handle returned by filesystem_open
+  * @param offset the new position, relative to whence
+  * @param whence LFS_SEEK_SET, LFS_SEEK_CUR or LFS_SEEK_END
+  * @return the new position, or a negative error code.
+  */
+int32_t filesystem_seek(filesystem_file_t file, int32_t offset, int whence);
+
+/** @brief Gets the size of an open file, including anything written but not yet synced.
+  * @param file a handle returned by filesystem_open
+  * @return the file's size in bytes, or a negative error code.
+  */
+int32_t filesystem_size(filesystem_file_t file);
+
+/** @brief Commits anything written to an open file to flash, leaving the file open.
+  * @param file a handle returned by filesystem_open
+  * @return true if the sync was successful; false otherwise
+  */
+bool filesystem_sync(filesystem_file_t file);
+
+/** @brief Closes a file, committing anything written to it, and frees its handle.
+  * @param file a handle returned by filesystem_open
+  * @return true if the file was closed successfully; false otherwise. The handle is freed either way.
+  */
+bool filesystem_close(filesystem_file_t file);
+
 /** @brief Reads a file from the filesystem into a buffer
   * @param filename the file you wish to read
   * @param buf A buffer of at least length bytes; the file will be read into this buffer
@@ -77,30 +165,131 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length);
   *               to reflect the offset of the next line.
   * @param length The maximum number of bytes to read
   * @return true if the read was successful; false otherwise
+  * @note This opens the file and seeks to offset on every call. To read through a file a line at a time,
+  *       use filesystem_open_line_reader and filesystem_read_next_line instead.
   */
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length);
 
+/** @brief Opens a file for reading line by line.
+  * @param reader the line reader to set up; it must stay around until filesystem_close_line_reader.
+  * @param filename the file you wish to read
+  * @return true if the file was opened; false otherwise. There is no need to close a reader that failed to open.
+  * @note A line reader holds one of the FILESYSTEM_MAX_OPEN_FILES handles until it is closed.
+  */
+bool filesystem_open_line_reader(filesystem_line_reader_t *reader, char *filename);
+
+/** @brief Reads the next line from a line reader into a buffer
+  * @param reader an open line reader
+  * @param buf A buffer of at least length + 1 bytes; the line will be read into this buffer, without its
+  *            newline, and terminated with a 0.
+  * @param length The maximum number of bytes to read. If the line is longer, the rest of it is skipped, so
+  *               the next call still starts at the beginning of the next line.
+  * @return true if a line was read, even an empty one; false at the end of the file or on a read error.
+  */
+bool filesystem_read_next_line(filesystem_line_reader_t *reader, char *buf, int32_t length);
+
+/** @brief Gets the offset into the file of the line that filesystem_read_next_line will read next.
+  * @param reader an open line reader
+  */
+int32_t filesystem_line_reader_tell(filesystem_line_reader_t *reader);
+
+/** @brief Moves a line reader to an offset into its file; the next line read starts there.
+  * @param reader an open line reader
+  * @param offset the offset into the file, e.g. as returned by filesystem_line_reader_tell
+  * @return true if the seek was successful; false otherwise
+  */
+bool filesystem_line_reader_seek(filesystem_line_reader_t *reader, int32_t offset);
+
+/** @brief Closes a line reader's file.
+  * @param reader an open line reader
+  */
+void filesystem_close_line_reader(filesystem_line_reader_t *reader);
+
 /** @brief Writes file to the filesystem
   * @param filename the file you wish to write
   * @param text The contents of the file
   * @param length The number of bytes to write
-  * @return true if the write was successful; false otherwise
+  * @return true if the write was successful or queued; false otherwise
+  * @note Writes that fit in the write queue return right away, and go out to flash later; see
+  *       filesystem_service. Until then, anything that reads or opens the file writes it out first.
   */
 bool filesystem_write_file(char *filename, char *text, int32_t length);
 
+/** @brief Writes data into a file at an offset, leaving the rest of the file as it was.
+  * @param filename the file you wish to write; it is created if it doesn't exist.
+  * @param offset The offset into the file to write at. If this is past the end of the file, the gap is filled
+  *               with zeros.
+  * @param data The bytes to write
+  * @param length The number of bytes to write
+  * @return true if the write was successful or queued; false otherwise
+  * @note Queued like filesystem_write_file. littlefs still copies each block of the file that the write touches, but only those blocks, so
+  *       updating one record in a file of fixed-size records costs a block or two instead of the whole file.
+  */
+bool filesystem_write_at(char *filename, int32_t offset, char *data, int32_t length);
+
+/// The span of a file's in-memory copy that has changed since it was last written out; see filesystem_mark_dirty.
+typedef struct {
+    int32_t start;  // the first changed byte
+    int32_t end;    // one past the last changed byte, or equal to start when nothing has changed
+} filesystem_dirty_range_t;
+
+/** @brief Notes that part of a file's in-memory copy has changed, so that a later filesystem_write_dirty
+  *        writes out every change made since the last one in a single write.
+  * @param range the file's dirty range; zero it to start out with nothing to write.
+  * @param offset the offset of the first byte that changed
+  * @param length the number of bytes that changed
+  */
+void filesystem_mark_dirty(filesystem_dirty_range_t *range, int32_t offset, int32_t length);
+
+/** @brief Writes out the part of a file's in-memory copy that has changed, and marks it clean again.
+  * @param filename the file to write
+  * @param data the in-memory copy of the whole file
+  * @param range the file's dirty range
+  * @return true if the write was successful or there was nothing to write; false otherwise, in which case the
+  *         range stays dirty so that the write can be tried again.
+  */
+bool filesystem_write_dirty(char *filename, char *data, filesystem_dirty_range_t *range);
+
 /** @brief Appends text to file on the filesystem
   * @param filename the file you wish to write
   * @param text The contents to write
   * @param length The number of bytes to write
-  * @return true if the write was successful; false otherwise
+  * @return true if the write was successful or queued; false otherwise
+  * @note Queued like filesystem_write_file; appends to the file the last queued write was for are combined
+  *       with it.
   */
 bool filesystem_append_file(char *filename, char *text, int32_t length);
 
+/** @brief Writes out the oldest write in the queue, if there is one.
+  * @details filesystem_write_file, filesystem_write_at and filesystem_append_file only queue their writes, so
+  *          that a face's loop doesn't wait on the flash. Movement calls this once each time through its main
+  *          loop, and stays awake until the queue is empty, so the buttons are handled between writes instead
+  *          of after all of them.
+  * @return true if there are more writes in the queue; false once it is empty.
+  */
+bool filesystem_service(void);
+
+/** @brief Writes out everything in the queue. Call this before anything that would lose RAM, like a reset.
+  * @return true if every write was successful; false otherwise.
+  */
+bool filesystem_flush(void);
+
 int filesystem_cmd_ls(int argc, char *argv[]);
 int filesystem_cmd_cat(int argc, char *argv[]);
 int filesystem_cmd_df(int argc, char *argv[]);
 int filesystem_cmd_rm(int argc, char *argv[]);
 int filesystem_cmd_format(int argc, char *argv[]);
 int filesystem_cmd_echo(int argc, char *argv[]);
+int filesystem_cmd_sync(int argc, char *argv[]);
+
+#ifdef WATCH_HOST
+/** @brief Host build only: closes every file, changes the littlefs configuration, and formats and mounts the
+  *        filesystem with it. The host runner's benchmark uses this to compare configurations.
+  * @param read_size, prog_size, lookahead_size, block_cycles as in struct lfs_config. The read and program
+  *        sizes have to divide NVMCTRL_PAGE_SIZE, which stays the cache size.
+  * @return LFS_ERR_OK, or the error from formatting or mounting.
+  */
+int _filesystem_host_configure(lfs_size_t read_size, lfs_size_t prog_size, lfs_size_t lookahead_size, int32_t block_cycles);
+#endif
 
 #endif // FILESYSTEM_H_
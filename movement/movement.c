@@ -22,7 +22,15 @@
  * SOFTWARE.
  */
 
-#define MOVEMENT_LONG_PRESS_TICKS 64
+// Long presses are timed on a slow periodic tick that only runs while a button is down, so a held button
+// doesn't keep the 128 Hz fast tick going. A press becomes a long press on the fifth 8 Hz edge after it
+// started, i.e. somewhere between 0.5 and 0.625 seconds in.
+#define MOVEMENT_BUTTON_TICK_FREQUENCY 8
+#define MOVEMENT_LONG_PRESS_TICKS 5
+// Marks a button that is still down but has already fired its long press.
+#define MOVEMENT_BUTTON_LONG_PRESSED UINT16_MAX
+// How many interrupt events can wait for app_loop. Must be a power of two, so the ring indices can wrap with a mask.
+#define MOVEMENT_EVENT_QUEUE_SIZE 16
 
 #include <stdio.h>
 #include <string.h>
@@ -31,6 +39,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "watch.h"
+#include "watch_utility.h"
 #include "filesystem.h"
 #include "movement.h"
 #include "shell.h"
@@ -95,15 +104,17 @@
 #define MOVEMENT_DEFAULT_LED_DURATION 1
 #endif
 
+// Room for buffers that only last until the current face resigns.
+#ifndef MOVEMENT_SCRATCH_SIZE
+#define MOVEMENT_SCRATCH_SIZE 256
+#endif
+
 #if __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
 movement_state_t movement_state;
 
-/* Defined here and initialized at runtime to avoid constant-expression issues */
-watch_face_t watch_faces[MOVEMENT_NUM_FACES];
-
 watch_face_t watch_faces[] = {
     simple_clock_face,
     goal_tracker_face,
@@ -115,14 +126,83 @@ watch_face_t watch_faces[] = {
     set_time_face,
     thermistor_readout_face,
     voltage_face,       // ← your custom face added here
-};d
+};
 
 void * watch_face_contexts[MOVEMENT_NUM_FACES];
 watch_date_time scheduled_tasks[MOVEMENT_NUM_FACES];
+// low energy mode shuts down the peripherals faces may have set up. rather than set up every face again on the way
+// out, we note which ones still need it, and set each one up just before it's next activated, or handed a background
+// task once we're awake.
+static bool face_needs_setup[MOVEMENT_NUM_FACES];
+// faces that asked to hear when the clock is set, and which of them haven't heard about the latest change yet.
+static bool face_wants_time_changes[MOVEMENT_NUM_FACES];
+static bool face_time_changed[MOVEMENT_NUM_FACES];
+
+_Static_assert(sizeof(watch_faces) / sizeof(watch_faces[0]) == MOVEMENT_NUM_FACES,
+               "watch_faces and MOVEMENT_NUM_FACES in movement_config.h disagree");
+_Static_assert(MOVEMENT_CONTEXT_ARENA_SIZE > 0 && MOVEMENT_CONTEXT_ARENA_SIZE <= UINT16_MAX,
+               "MOVEMENT_CONTEXT_ARENA_SIZE in movement_config.h is out of range");
+static uint8_t context_arena[MOVEMENT_CONTEXT_ARENA_SIZE] __attribute__((aligned(8)));
+static uint16_t context_arena_used;
+static uint16_t face_context_bytes[MOVEMENT_NUM_FACES];
+// the face whose setup is running, if any; that's who gets charged for a context allocation.
+static int16_t face_in_setup = -1;
+static uint8_t scratch_arena[MOVEMENT_SCRATCH_SIZE] __attribute__((aligned(8)));
+static uint16_t scratch_used;
+static uint16_t scratch_high_water;
 const int32_t movement_le_inactivity_deadlines[8] = {INT_MAX, 600, 3600, 7200, 21600, 43200, 86400, 604800};
 const int16_t movement_timeout_inactivity_deadlines[4] = {60, 120, 300, 1800};
 movement_event_t event;
 
+// Events raised by the button and RTC interrupts, waiting to be handled by app_loop. The interrupt handlers are the
+// only producer (they all run at the same NVIC priority, so they can't preempt one another) and app_loop is the only
+// consumer; the producer only ever writes event_queue_head, and the consumer only ever writes event_queue_tail.
+static volatile movement_event_t event_queue[MOVEMENT_EVENT_QUEUE_SIZE];
+static volatile uint8_t event_queue_head;
+static volatile uint8_t event_queue_tail;
+static volatile uint16_t event_queue_overflows;
+static volatile uint8_t event_queue_high_water;
+static uint16_t event_queue_drops;
+// when the face changes, how many of the events still in the queue were raised for the old face.
+static uint8_t event_queue_stale_events;
+
+// one round of the alarm is four beeps in 0.375 seconds, then quiet for the rest of the second. the sequencer runs at
+// 64 Hz and holds each note for one tick more than its duration, so these add up to 64 ticks.
+// movement_play_alarm_beeps fills in the note, and how many more times to play the round.
+#define MOVEMENT_ALARM_TUNE_ROUNDS 17
+static int8_t alarm_tune[] = {
+    BUZZER_NOTE_C8, 2, BUZZER_NOTE_REST, 2,
+    BUZZER_NOTE_C8, 2, BUZZER_NOTE_REST, 2,
+    BUZZER_NOTE_C8, 2, BUZZER_NOTE_REST, 2,
+    BUZZER_NOTE_C8, 4, BUZZER_NOTE_REST, 40,
+    -8, 0,
+    0
+};
+static void (*alarm_ended_callback)(void);
+// what the hourly signal does when it ends: clears is_buzzing, and turns the buzzer off if the signal turned it on.
+static void (*signal_ended_callback)(void);
+
+// how long each face's functions have taken, by face index and movement_perf_call_t, and since when.
+static movement_perf_counter_t perf_counters[MOVEMENT_NUM_FACES][MOVEMENT_NUM_PERF_CALLS];
+static uint32_t perf_started_at;
+// time from leaving low energy mode to the end of the face's first loop, i.e. until the wearer sees something.
+static movement_perf_counter_t wake_latency;
+static uint32_t wake_started_at;
+static bool wake_latency_pending;
+
+// the animation playing on the tick, if any; see movement_play_animation. the tick interrupt only counts ticks
+// in animation_ticks_elapsed; the main loop draws the frames, so that only it ever touches the display.
+static const movement_animation_step_t *animation_steps;
+static uint16_t animation_num_steps;
+static uint16_t animation_next_step;
+static uint8_t animation_ticks_left;
+static uint16_t animation_keyframes;
+static bool animation_loops;
+static volatile bool animation_playing;
+static volatile uint8_t animation_ticks_elapsed;
+static uint8_t animation_ticks_handled;
+static movement_animation_stats_t animation_stats;
+
 const int16_t movement_timezone_offsets[] = {
     0,      //  0 :   0:00:00 (UTC)
     60,     //  1 :   1:00:00 (Central European Time)
@@ -176,6 +256,7 @@ void cb_alarm_btn_interrupt(void);
 void cb_alarm_btn_extwake(void);
 void cb_alarm_fired(void);
 void cb_fast_tick(void);
+void cb_button_tick(void);
 void cb_tick(void);
 
 static inline void _movement_reset_inactivity_countdown(void) {
@@ -183,6 +264,42 @@ static inline void _movement_reset_inactivity_countdown(void) {
     movement_state.timeout_ticks = movement_timeout_inactivity_deadlines[movement_state.settings.bit.to_interval];
 }
 
+static void _movement_queue_event(movement_event_type_t event_type) {
+    uint8_t head = event_queue_head;
+    uint8_t depth = head - event_queue_tail;
+    if (depth >= MOVEMENT_EVENT_QUEUE_SIZE) {
+        event_queue_overflows++;
+        return;
+    }
+    event_queue[head & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].event_type = event_type;
+    event_queue[head & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].subsecond = movement_state.subsecond;
+    // only publish the event once it's completely written.
+    event_queue_head = head + 1;
+    if (depth + 1 > event_queue_high_water) event_queue_high_water = depth + 1;
+}
+
+static bool _movement_dequeue_event(movement_event_t *queued_event) {
+    while (event_queue_tail != event_queue_head) {
+        uint8_t tail = event_queue_tail;
+        queued_event->event_type = event_queue[tail & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].event_type;
+        queued_event->subsecond = event_queue[tail & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].subsecond;
+        event_queue_tail = tail + 1;
+
+        if (event_queue_stale_events) {
+            event_queue_stale_events--;
+            // ticks and animations were started by the face that resigned; the new face asks for its own.
+            if (queued_event->event_type == EVENT_TICK ||
+                queued_event->event_type == EVENT_ANIMATION_KEYFRAME ||
+                queued_event->event_type == EVENT_ANIMATION_DONE) {
+                event_queue_drops++;
+                continue;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
 static inline void _movement_enable_fast_tick_if_needed(void) {
     if (!movement_state.fast_tick_enabled) {
         movement_state.fast_ticks = 0;
@@ -192,51 +309,199 @@ static inline void _movement_enable_fast_tick_if_needed(void) {
 }
 
 static inline void _movement_disable_fast_tick_if_possible(void) {
-    if ((movement_state.light_ticks == -1) &&
-        (movement_state.alarm_ticks == -1) &&
-        ((movement_state.light_down_timestamp + movement_state.mode_down_timestamp + movement_state.alarm_down_timestamp) == 0)) {
+    if (movement_state.light_ticks == -1) {
         movement_state.fast_tick_enabled = false;
         watch_rtc_disable_periodic_callback(128);
     }
 }
 
-static void _movement_handle_background_tasks(void) {
+static inline void _movement_enable_button_timer_if_needed(void) {
+    if (!movement_state.button_timer_enabled) {
+        movement_state.button_ticks = 0;
+        // if the face is already ticking at this rate, cb_tick times the buttons and we don't need a second callback.
+        if (movement_state.tick_frequency != MOVEMENT_BUTTON_TICK_FREQUENCY)
+            watch_rtc_register_periodic_callback(cb_button_tick, MOVEMENT_BUTTON_TICK_FREQUENCY);
+        movement_state.button_timer_enabled = true;
+    }
+}
+
+static inline bool _movement_button_is_being_timed(uint16_t down_timestamp) {
+    return down_timestamp != 0 && down_timestamp != MOVEMENT_BUTTON_LONG_PRESSED;
+}
+
+static inline uint16_t _movement_button_ticks_held(uint16_t down_timestamp) {
+    return movement_state.button_ticks - (down_timestamp - 1);
+}
+
+static inline void _movement_disable_button_timer_if_possible(void) {
+    // a button that's already fired its long press has nothing left to time, even if it's still held.
+    if (!_movement_button_is_being_timed(movement_state.light_down_timestamp) &&
+        !_movement_button_is_being_timed(movement_state.mode_down_timestamp) &&
+        !_movement_button_is_being_timed(movement_state.alarm_down_timestamp)) {
+        movement_state.button_timer_enabled = false;
+        if (movement_state.tick_frequency != MOVEMENT_BUTTON_TICK_FREQUENCY)
+            watch_rtc_disable_periodic_callback(MOVEMENT_BUTTON_TICK_FREQUENCY);
+    }
+}
+
+static void _movement_perf_record(movement_perf_counter_t *counter, uint32_t started_at) {
+    uint32_t elapsed = watch_perf_get_us() - started_at;
+    counter->calls++;
+    counter->total_us += elapsed;
+    if (elapsed > counter->max_us) counter->max_us = elapsed;
+}
+
+// all calls into a watch face go through these, so that we can keep track of what each one costs.
+static void _movement_face_setup(uint8_t face_idx) {
+    uint32_t started_at = watch_perf_get_us();
+    face_in_setup = face_idx;
+    watch_faces[face_idx].setup(&movement_state.settings, face_idx, &watch_face_contexts[face_idx]);
+    face_in_setup = -1;
+    _movement_perf_record(&perf_counters[face_idx][MOVEMENT_PERF_SETUP], started_at);
+}
+
+static void _movement_face_setup_if_needed(uint8_t face_idx) {
+    if (!face_needs_setup[face_idx]) return;
+    face_needs_setup[face_idx] = false;
+    _movement_face_setup(face_idx);
+}
+
+// faces keep the setup they had when low energy mode started, and that's what their background tasks run on there.
+// setting one up again would switch its peripherals back on while the watch is asleep; that waits until we wake.
+static void _movement_face_setup_for_background_task(uint8_t face_idx) {
+    if (movement_state.le_mode_ticks == -1) return;
+    _movement_face_setup_if_needed(face_idx);
+}
+
+static void _movement_face_activate(uint8_t face_idx) {
+    uint32_t started_at = watch_perf_get_us();
+    watch_faces[face_idx].activate(&movement_state.settings, watch_face_contexts[face_idx]);
+    _movement_perf_record(&perf_counters[face_idx][MOVEMENT_PERF_ACTIVATE], started_at);
+}
+
+static bool _movement_face_loop(uint8_t face_idx, movement_event_t face_event) {
+    uint32_t started_at = watch_perf_get_us();
+    bool can_sleep = watch_faces[face_idx].loop(face_event, &movement_state.settings, watch_face_contexts[face_idx]);
+    _movement_perf_record(&perf_counters[face_idx][MOVEMENT_PERF_LOOP], started_at);
+
+    return can_sleep;
+}
+
+static void _movement_face_resign(uint8_t face_idx) {
+    uint32_t started_at = watch_perf_get_us();
+    watch_faces[face_idx].resign(&movement_state.settings, watch_face_contexts[face_idx]);
+    _movement_perf_record(&perf_counters[face_idx][MOVEMENT_PERF_RESIGN], started_at);
+
+    // whatever the face had in scratch is gone now.
+    scratch_used = 0;
+}
+
+static bool _movement_face_wants_background_task(uint8_t face_idx) {
+    if (watch_faces[face_idx].wants_background_task == NULL) return false;
+
+    uint32_t started_at = watch_perf_get_us();
+    bool wants_background_task = watch_faces[face_idx].wants_background_task(&movement_state.settings, watch_face_contexts[face_idx]);
+    _movement_perf_record(&perf_counters[face_idx][MOVEMENT_PERF_WANTS_BACKGROUND_TASK], started_at);
+
+    return wants_background_task;
+}
+
+static void _movement_program_alarm(void) {
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t now_timestamp = watch_utility_date_time_to_unix_time(now, 0);
+    uint32_t next_timestamp = UINT32_MAX;
+
+    // the next deadline is the earliest scheduled task...
+    movement_state.next_scheduled_task.reg = 0;
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        // For each face, if the watch face wants a background task...
-        if (watch_faces[i].wants_background_task != NULL && watch_faces[i].wants_background_task(&movement_state.settings, watch_face_contexts[i])) {
-            // ...we give it one. pretty straightforward!
-            movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-            watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
+        if (scheduled_tasks[i].reg && (movement_state.next_scheduled_task.reg == 0 || scheduled_tasks[i].reg < movement_state.next_scheduled_task.reg)) {
+            movement_state.next_scheduled_task.reg = scheduled_tasks[i].reg;
         }
     }
-    movement_state.needs_background_tasks_handled = false;
+    movement_state.has_scheduled_background_task = movement_state.next_scheduled_task.reg != 0;
+
+    // a low energy display sequence is stepping on the alarm, and wakes us through cb_alarm_fired when it runs out.
+    if (watch_display_sequence_is_running()) return;
+
+    if (movement_state.has_scheduled_background_task) {
+        next_timestamp = watch_utility_date_time_to_unix_time(movement_state.next_scheduled_task, 0);
+    }
+
+    // ...unless we need to wake at the top of the minute, for faces that still poll for background tasks,
+    // or to update the display in low energy mode.
+    if (movement_state.has_polling_faces || movement_state.le_mode_ticks == -1) {
+        uint32_t top_of_minute = now_timestamp - now.unit.second + 60;
+        if (top_of_minute < next_timestamp) next_timestamp = top_of_minute;
+    }
+
+    // with the tick stopped, we also have to wake for the face's next redraw, and for the inactivity countdowns.
+    if (movement_state.ticks_suspended) {
+        uint32_t candidate = watch_utility_date_time_to_unix_time(movement_state.next_redraw, 0);
+        if (candidate < next_timestamp) next_timestamp = candidate;
+        if (movement_state.settings.bit.le_interval && movement_state.le_mode_ticks > 0) {
+            candidate = movement_state.ticks_suspended_at + movement_state.le_mode_ticks;
+            if (candidate < next_timestamp) next_timestamp = candidate;
+        }
+        if (movement_state.timeout_ticks > 0) {
+            candidate = movement_state.ticks_suspended_at + movement_state.timeout_ticks;
+            if (candidate < next_timestamp) next_timestamp = candidate;
+        }
+    }
+
+    if (next_timestamp == UINT32_MAX) {
+        watch_rtc_disable_alarm_callback();
+    } else if (next_timestamp <= now_timestamp) {
+        // already due; no need to wait for the alarm.
+        movement_state.needs_background_tasks_handled = true;
+    } else {
+        // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so we match the second before.
+        // deadlines more than a day out fire early and simply get rescheduled.
+        watch_date_time alarm_time = watch_utility_date_time_from_unix_time(next_timestamp - 1, 0);
+        watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_HHMMSS);
+    }
 }
 
-static void _movement_handle_scheduled_tasks(void) {
+static void _movement_handle_background_tasks(void) {
+    movement_state.needs_background_tasks_handled = false;
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint8_t num_active_tasks = 0;
 
+    // faces that implement wants_background_task get polled once a minute, at the top of the minute.
+    if (movement_state.has_polling_faces && date_time.unit.minute != movement_state.last_polled_minute) {
+        movement_state.last_polled_minute = date_time.unit.minute;
+        for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+            // For each face, if the watch face wants a background task...
+            if (_movement_face_wants_background_task(i)) {
+                // ...we give it one. pretty straightforward!
+                movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+                _movement_face_setup_for_background_task(i);
+                _movement_face_loop(i, background_event);
+            }
+        }
+    }
+
+    // faces that asked to hear about the clock being set get to reschedule before any deadline it passed comes due.
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg) {
-            if (scheduled_tasks[i].reg <= date_time.reg) {
+        if (!face_time_changed[i]) continue;
+        face_time_changed[i] = false;
+        movement_event_t time_changed_event = { EVENT_TIME_CHANGED, 0 };
+        _movement_face_setup_for_background_task(i);
+        _movement_face_loop(i, time_changed_event);
+    }
+    date_time = watch_rtc_get_date_time();
+
+    // faces that scheduled a background task get it once the deadline has passed.
+    if (movement_state.has_scheduled_background_task && movement_state.next_scheduled_task.reg <= date_time.reg) {
+        for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+            if (scheduled_tasks[i].reg && scheduled_tasks[i].reg <= date_time.reg) {
                 scheduled_tasks[i].reg = 0;
                 movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
-                // check if loop scheduled a new task
-                if (scheduled_tasks[i].reg) {
-                    num_active_tasks++;
-                }
-            } else {
-                num_active_tasks++;
+                _movement_face_setup_for_background_task(i);
+                _movement_face_loop(i, background_event);
             }
         }
     }
 
-    if (num_active_tasks == 0) {
-        movement_state.has_scheduled_background_task = false;
-    } else {
-        _movement_reset_inactivity_countdown();
-    }
+    _movement_program_alarm();
 }
 
 void movement_request_tick_frequency(uint8_t freq) {
@@ -247,12 +512,267 @@ void movement_request_tick_frequency(uint8_t freq) {
     // If we are asked for an invalid frequency, default back to 1 Hz.
     if (freq == 0 || __builtin_popcount(freq) != 1) freq = 1;
 
+    // animations run on the tick, so they can't outlive it.
+    animation_playing = false;
+    animation_steps = NULL;
+
     // disable all callbacks except the 128 Hz one
     watch_rtc_disable_matching_periodic_callbacks(0xFE);
 
     movement_state.subsecond = 0;
     movement_state.tick_frequency = freq;
+    movement_state.next_redraw.reg = 0;
     watch_rtc_register_periodic_callback(cb_tick, freq);
+    // if a button is being timed, the button tick was just switched off along with the old tick rate.
+    if (movement_state.button_timer_enabled && freq != MOVEMENT_BUTTON_TICK_FREQUENCY)
+        watch_rtc_register_periodic_callback(cb_button_tick, MOVEMENT_BUTTON_TICK_FREQUENCY);
+}
+
+void movement_request_next_redraw(watch_date_time date_time) {
+    movement_state.next_redraw = date_time;
+}
+
+// draws the steps that make up the next frame. returns false if there are none left.
+static bool _movement_animation_draw_next_frame(bool *keyframe) {
+    if (animation_next_step >= animation_num_steps) {
+        if (!animation_loops) return false;
+        animation_next_step = 0;
+    }
+
+    *keyframe = false;
+    do {
+        movement_animation_step_t step = animation_steps[animation_next_step++];
+        if (step.com != MOVEMENT_ANIMATION_NO_SEGMENT) {
+            if (step.on) watch_set_pixel(step.com, step.seg);
+            else watch_clear_pixel(step.com, step.seg);
+        }
+        if (step.keyframe) *keyframe = true;
+        animation_ticks_left = step.ticks;
+    } while (animation_ticks_left == 0 && animation_next_step < animation_num_steps);
+    // a last step with no ticks of its own still gets its frame shown for one.
+    if (animation_ticks_left == 0) animation_ticks_left = 1;
+
+    if (*keyframe) animation_keyframes++;
+    animation_stats.frames++;
+    return true;
+}
+
+// called from app_loop to catch up with the ticks cb_tick counted in place of queueing EVENT_TICK. returns the
+// event the face needs to hear about, if any: it only hears about keyframes and the end. it stops at an event,
+// so none is lost if the main loop fell behind; the face handles it, and the next pass picks up from there.
+static movement_event_type_t _movement_animation_catch_up(void) {
+    movement_event_type_t event_type = EVENT_NONE;
+    uint32_t started_at = watch_perf_get_us();
+
+    while (animation_playing && animation_ticks_handled != animation_ticks_elapsed) {
+        animation_ticks_handled++;
+        if (--animation_ticks_left) continue;
+        bool keyframe;
+        if (_movement_animation_draw_next_frame(&keyframe)) {
+            if (keyframe) event_type = EVENT_ANIMATION_KEYFRAME;
+        } else {
+            animation_playing = false;
+            animation_steps = NULL;
+            event_type = EVENT_ANIMATION_DONE;
+        }
+        if (event_type != EVENT_NONE) break;
+    }
+
+    _movement_perf_record(&animation_stats.ticks, started_at);
+    return event_type;
+}
+
+uint16_t movement_animation_add_frame(const watch_display_frame_t *from, const watch_display_frame_t *to,
+                                      movement_animation_step_t *steps, uint16_t max_steps, uint8_t ticks, bool keyframe) {
+    uint16_t num_steps = 0;
+
+    for (uint8_t com = 0; com < 3; com++) {
+        uint32_t changed = from->com[com] ^ to->com[com];
+        while (changed) {
+            if (num_steps == max_steps) return 0;
+            uint8_t seg = __builtin_ctz(changed);
+            changed &= changed - 1;
+            steps[num_steps].com = com;
+            steps[num_steps].seg = seg;
+            steps[num_steps].on = (to->com[com] >> seg) & 1;
+            steps[num_steps].keyframe = false;
+            steps[num_steps].ticks = 0;
+            num_steps++;
+        }
+    }
+    if (num_steps == 0) {
+        if (max_steps == 0) return 0;
+        steps[0].com = MOVEMENT_ANIMATION_NO_SEGMENT;
+        steps[0].seg = 0;
+        steps[0].on = false;
+        num_steps = 1;
+    }
+    // the frame's keyframe flag and duration go on its first and last steps.
+    steps[0].keyframe = keyframe;
+    steps[num_steps - 1].ticks = ticks;
+
+    return num_steps;
+}
+
+void movement_play_animation(const movement_animation_step_t *steps, uint16_t num_steps, uint8_t freq, bool loop) {
+    movement_request_tick_frequency(freq);
+    if (num_steps == 0) return;
+
+    animation_steps = steps;
+    animation_num_steps = num_steps;
+    animation_next_step = 0;
+    animation_keyframes = 0;
+    animation_loops = loop;
+
+    // the first frame goes up now; the face is already running, so it gets no keyframe event for it.
+    bool keyframe;
+    _movement_animation_draw_next_frame(&keyframe);
+    // only now that everything is in place can the tick interrupt start counting for it.
+    animation_ticks_handled = animation_ticks_elapsed;
+    animation_playing = true;
+}
+
+void movement_stop_animation(void) {
+    animation_playing = false;
+}
+
+void movement_resume_animation(void) {
+    // once an animation is done or the tick frequency has changed, there's nothing to resume.
+    if (animation_steps == NULL) return;
+    animation_ticks_handled = animation_ticks_elapsed;
+    animation_playing = true;
+}
+
+bool movement_animation_is_playing(void) {
+    return animation_playing;
+}
+
+uint16_t movement_get_animation_keyframe(void) {
+    return animation_keyframes - 1;
+}
+
+movement_animation_stats_t movement_get_animation_stats(void) {
+    return animation_stats;
+}
+
+static void _movement_suspend_ticks_if_possible(void) {
+    if (movement_state.next_redraw.reg == 0 || movement_state.tick_frequency != 1 || movement_state.fast_tick_enabled) return;
+
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t now_timestamp = watch_utility_date_time_to_unix_time(now, 0);
+    // if the redraw is due at the very next tick, there's nothing to gain.
+    if (watch_utility_date_time_to_unix_time(movement_state.next_redraw, 0) <= now_timestamp + 1) return;
+
+    watch_rtc_disable_periodic_callback(1);
+    movement_state.ticks_suspended = true;
+    movement_state.ticks_suspended_at = now_timestamp;
+    _movement_program_alarm();
+}
+
+static void _movement_resume_ticks(void) {
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t elapsed = watch_utility_date_time_to_unix_time(now, 0) - movement_state.ticks_suspended_at;
+
+    // catch the inactivity countdowns up on the ticks they missed.
+    if (movement_state.settings.bit.le_interval && movement_state.le_mode_ticks > 0) {
+        movement_state.le_mode_ticks = (movement_state.le_mode_ticks > (int32_t)elapsed) ? movement_state.le_mode_ticks - (int32_t)elapsed : 0;
+    }
+    if (movement_state.timeout_ticks > 0) {
+        movement_state.timeout_ticks = (movement_state.timeout_ticks > (int32_t)elapsed) ? movement_state.timeout_ticks - (int16_t)elapsed : 0;
+    }
+    movement_state.last_second = now.unit.second;
+    movement_state.subsecond = 0;
+
+    movement_state.ticks_suspended = false;
+    watch_rtc_register_periodic_callback(cb_tick, 1);
+
+    if (movement_state.next_redraw.reg <= now.reg) {
+        // this is the wake the face asked for; it comes in as an ordinary tick.
+        movement_state.next_redraw.reg = 0;
+        if (event.event_type == EVENT_NONE) event.event_type = EVENT_TICK;
+    } else if (event_queue_head != event_queue_tail) {
+        // a button press may change what's on screen, so the face has to ask again.
+        movement_state.next_redraw.reg = 0;
+    }
+}
+
+movement_event_queue_stats_t movement_get_event_queue_stats(void) {
+    movement_event_queue_stats_t stats;
+    stats.depth = (uint8_t)(event_queue_head - event_queue_tail);
+    stats.capacity = MOVEMENT_EVENT_QUEUE_SIZE;
+    stats.high_water = event_queue_high_water;
+    stats.overflows = event_queue_overflows;
+    stats.drops = event_queue_drops;
+    return stats;
+}
+
+bool movement_get_perf_counter(uint8_t watch_face_index, movement_perf_call_t call, movement_perf_counter_t *counter) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES || call >= MOVEMENT_NUM_PERF_CALLS) return false;
+    *counter = perf_counters[watch_face_index][call];
+    return true;
+}
+
+void *movement_alloc_context(size_t size) {
+    uint8_t face_idx = face_in_setup >= 0 ? face_in_setup : movement_state.current_face_idx;
+    size_t alloc_size = MOVEMENT_CONTEXT_SIZE(size);
+
+    if (alloc_size > (size_t)(MOVEMENT_CONTEXT_ARENA_SIZE - context_arena_used)) {
+        // the arena was sized from what each face's header says it needs, so some face is allocating more than that.
+        printf("Face %d wants %u bytes of context, and only %u are left. Check its _CONTEXT_SIZE.\r\n",
+               face_idx, (unsigned int)size, (unsigned int)(MOVEMENT_CONTEXT_ARENA_SIZE - context_arena_used));
+        return NULL;
+    }
+
+    void *ptr = &context_arena[context_arena_used];
+    context_arena_used += alloc_size;
+    face_context_bytes[face_idx] += size;
+
+    return ptr;
+}
+
+void *movement_alloc_scratch(size_t size) {
+    size_t alloc_size = MOVEMENT_CONTEXT_SIZE(size);
+    if (alloc_size > (size_t)(MOVEMENT_SCRATCH_SIZE - scratch_used)) return NULL;
+
+    void *ptr = &scratch_arena[scratch_used];
+    scratch_used += alloc_size;
+    if (scratch_used > scratch_high_water) scratch_high_water = scratch_used;
+
+    return ptr;
+}
+
+movement_memory_stats_t movement_get_memory_stats(void) {
+    movement_memory_stats_t stats;
+    stats.arena_used = context_arena_used;
+    stats.arena_size = MOVEMENT_CONTEXT_ARENA_SIZE;
+    stats.scratch_used = scratch_used;
+    stats.scratch_size = MOVEMENT_SCRATCH_SIZE;
+    stats.scratch_high_water = scratch_high_water;
+    return stats;
+}
+
+bool movement_get_context_bytes(uint8_t watch_face_index, uint16_t *bytes) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return false;
+    *bytes = face_context_bytes[watch_face_index];
+    return true;
+}
+
+movement_perf_counter_t movement_get_wake_latency(void) {
+    return wake_latency;
+}
+
+uint32_t movement_get_perf_elapsed_seconds(void) {
+    // this goes by the RTC, so setting the time will throw it off until the next reset.
+    return watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0) - perf_started_at;
+}
+
+void movement_reset_perf_counters(void) {
+    memset(perf_counters, 0, sizeof(perf_counters));
+    memset(&wake_latency, 0, sizeof(wake_latency));
+    memset(&animation_stats, 0, sizeof(animation_stats));
+    perf_started_at = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    watch_perf_reset_stats();
+    watch_display_reset_stats();
 }
 
 void movement_illuminate_led(void) {
@@ -329,21 +849,31 @@ void movement_cancel_background_task(void) {
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time date_time) {
     watch_date_time now = watch_rtc_get_date_time();
     if (date_time.reg > now.reg) {
-        movement_state.has_scheduled_background_task = true;
         scheduled_tasks[watch_face_index].reg = date_time.reg;
+        _movement_program_alarm();
     }
 }
 
 void movement_cancel_background_task_for_face(uint8_t watch_face_index) {
+    if (scheduled_tasks[watch_face_index].reg == 0) return;
     scheduled_tasks[watch_face_index].reg = 0;
-    bool other_tasks_scheduled = false;
+    _movement_program_alarm();
+}
+
+void movement_set_date_time(watch_date_time date_time) {
+    watch_rtc_set_date_time(date_time);
+
+    // deadlines stay where they are; the faces that asked hear about the change on the next pass of the main loop,
+    // which also runs any task the clock was set past.
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg != 0) {
-            other_tasks_scheduled = true;
-            break;
-        }
+        if (face_wants_time_changes[i]) face_time_changed[i] = true;
     }
-    movement_state.has_scheduled_background_task = other_tasks_scheduled;
+    movement_state.needs_background_tasks_handled = true;
+    _movement_program_alarm();
+}
+
+void movement_request_time_changed_events(uint8_t watch_face_index) {
+    if (watch_face_index < MOVEMENT_NUM_FACES) face_wants_time_changes[watch_face_index] = true;
 }
 
 void movement_request_wake() {
@@ -351,6 +881,21 @@ void movement_request_wake() {
     _movement_reset_inactivity_countdown();
 }
 
+void movement_set_low_energy_frames(const watch_display_frame_t *frames, uint8_t num_frames) {
+    // faces that poll for background tasks need the alarm every minute, so they get one frame at a time.
+    if (movement_state.le_mode_ticks != -1 || movement_state.has_polling_faces) num_frames = 1;
+
+    // otherwise the sequence has to run out, and wake us, no later than the minute the next scheduled task is due.
+    if (num_frames > 1 && movement_state.has_scheduled_background_task) {
+        uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+        uint32_t due = watch_utility_date_time_to_unix_time(movement_state.next_scheduled_task, 0);
+        uint32_t minutes_until_due = (due > now) ? (due - (now - now % 60)) / 60 : 0;
+        if (num_frames > minutes_until_due + 1) num_frames = minutes_until_due + 1;
+    }
+
+    watch_display_start_minute_sequence(frames, num_frames, cb_alarm_fired);
+}
+
 static void end_buzzing() {
     movement_state.is_buzzing = false;
 }
@@ -368,15 +913,40 @@ static void set_initial_clock_mode(void) {
 #endif
 }
 
+static void end_alarm(void) {
+    movement_state.alarm_playing = false;
+}
+
+static void end_alarm_and_disable_buzzer(void) {
+    end_alarm();
+    watch_disable_buzzer();
+}
+
+static void _movement_stop_alarm(void) {
+    watch_buzzer_abort_sequence();
+    alarm_ended_callback();
+}
+
+static void _movement_stop_signal(void) {
+    watch_buzzer_abort_sequence();
+    signal_ended_callback();
+}
+
 void movement_play_signal(void) {
-    void *maybe_disable_buzzer = end_buzzing_and_disable_buzzer;
-    if (watch_is_buzzer_or_led_enabled()) {
-        maybe_disable_buzzer = end_buzzing;
-    } else {
-        watch_enable_buzzer();
+    // the signal takes over the sequencer, so if the alarm was playing, stop it the way a button press would.
+    if (movement_state.alarm_playing) _movement_stop_alarm();
+
+    // if the signal is already playing, we start over, but it's still up to the first call to turn the buzzer back off.
+    if (!movement_state.is_buzzing) {
+        signal_ended_callback = end_buzzing_and_disable_buzzer;
+        if (watch_is_buzzer_or_led_enabled()) {
+            signal_ended_callback = end_buzzing;
+        } else {
+            watch_enable_buzzer();
+        }
     }
     movement_state.is_buzzing = true;
-    watch_buzzer_play_sequence(signal_tune, maybe_disable_buzzer);
+    watch_buzzer_play_sequence(signal_tune, signal_ended_callback);
     if (movement_state.le_mode_ticks == -1) {
         // the watch is asleep. wake it up for "1" round through the main loop.
         // the sleep_mode_app_loop will notice the is_buzzing and note that it
@@ -395,10 +965,24 @@ void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note) {
     if (rounds == 0) rounds = 1;
     if (rounds > 20) rounds = 20;
     movement_request_wake();
-    movement_state.alarm_note = alarm_note;
-    // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given.
-    movement_state.alarm_ticks = 128 * rounds - 75;
-    _movement_enable_fast_tick_if_needed();
+
+    for (uint8_t i = 0; i < 16; i += 4) alarm_tune[i] = alarm_note;
+    alarm_tune[MOVEMENT_ALARM_TUNE_ROUNDS] = rounds - 1;
+
+    // the alarm takes over the sequencer, so if the signal was playing, it's done; let it turn off what it turned on.
+    if (movement_state.is_buzzing) _movement_stop_signal();
+
+    // if the alarm is already playing, we start over, but it's still up to the first call to turn the buzzer back off.
+    if (!movement_state.alarm_playing) {
+        alarm_ended_callback = end_alarm_and_disable_buzzer;
+        if (watch_is_buzzer_or_led_enabled()) {
+            alarm_ended_callback = end_alarm;
+        } else {
+            watch_enable_buzzer();
+        }
+    }
+    movement_state.alarm_playing = true;
+    watch_buzzer_play_sequence(alarm_tune, alarm_ended_callback);
 }
 
 uint8_t movement_claim_backup_register(void) {
@@ -425,14 +1009,11 @@ void app_init(void) {
     movement_state.settings.bit.led_duration = MOVEMENT_DEFAULT_LED_DURATION;
 
     movement_state.light_ticks = -1;
-    movement_state.alarm_ticks = -1;
     movement_state.next_available_backup_register = 4;
     _movement_reset_inactivity_countdown();
 
     filesystem_init();
 
-    movement_init_faces();
-    
 #if __EMSCRIPTEN__
     int32_t time_zone_offset = EM_ASM_INT({
         return -new Date().getTimezoneOffset();
@@ -454,6 +1035,7 @@ void app_setup(void) {
     watch_store_backup_data(movement_state.settings.reg, 0);
 
     static bool is_first_launch = true;
+    bool faces_need_context = is_first_launch;
 
     if (is_first_launch) {
         #ifdef MOVEMENT_CUSTOM_BOOT_COMMANDS
@@ -463,16 +1045,15 @@ void app_setup(void) {
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
             watch_face_contexts[i] = NULL;
             scheduled_tasks[i].reg = 0;
+            if (watch_faces[i].wants_background_task != NULL) movement_state.has_polling_faces = true;
             is_first_launch = false;
         }
-
-        // set up the 1 minute alarm (for background tasks and low power updates)
-        watch_date_time alarm_time;
-        alarm_time.reg = 0;
-        alarm_time.unit.second = 59; // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so 59 seconds lets us update at :00
-        watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+        movement_state.last_polled_minute = watch_rtc_get_date_time().unit.minute;
+        perf_started_at = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
     }
     if (movement_state.le_mode_ticks != -1) {
+        // whatever the display sequence left up is about to be redrawn, and the alarm is ours again.
+        watch_display_stop_sequence();
         watch_disable_extwake_interrupt(BTN_ALARM);
 
         watch_enable_external_interrupts();
@@ -486,13 +1067,21 @@ void app_setup(void) {
 
         movement_request_tick_frequency(1);
 
-        for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-            watch_faces[i].setup(&movement_state.settings, i, &watch_face_contexts[i]);
+        if (faces_need_context) {
+            // every face gets to allocate its context up front; after this, faces are set up on demand.
+            for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+                _movement_face_setup(i);
+            }
+        } else {
+            _movement_face_setup_if_needed(movement_state.current_face_idx);
         }
 
-        watch_faces[movement_state.current_face_idx].activate(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_face_activate(movement_state.current_face_idx);
         event.subsecond = 0;
         event.event_type = EVENT_ACTIVATE;
+
+        // wake for the next background task; out of low energy mode, we no longer need to wake every minute.
+        _movement_program_alarm();
     }
 }
 
@@ -504,13 +1093,22 @@ void app_wake_from_standby(void) {
 
 static void _sleep_mode_app_loop(void) {
     movement_state.needs_wake = false;
+    int8_t last_update_minute = -1;
     // as long as le_mode_ticks is -1 (i.e. we are in low energy mode), we wake up here, update the screen, and go right back to sleep.
     while (movement_state.le_mode_ticks == -1) {
         // we also have to handle background tasks here in the mini-runloop
         if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
 
-        event.event_type = EVENT_LOW_ENERGY_UPDATE;
-        watch_faces[movement_state.current_face_idx].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        // a scheduled task can wake us mid-minute, but the display only needs updating once the minute changes.
+        uint8_t minute = watch_rtc_get_date_time().unit.minute;
+        if (minute != last_update_minute) {
+            last_update_minute = minute;
+            event.event_type = EVENT_LOW_ENERGY_UPDATE;
+            _movement_face_loop(movement_state.current_face_idx, event);
+        }
+
+        // nobody is waiting on the buttons in here, so write out whatever the faces queued all at once.
+        filesystem_flush();
 
         // if we need to wake immediately, do it!
         if (movement_state.needs_wake) return;
@@ -519,23 +1117,42 @@ static void _sleep_mode_app_loop(void) {
     }
 }
 
+static bool _movement_dispatch_event(movement_event_t dispatched_event) {
+    bool can_sleep = _movement_face_loop(movement_state.current_face_idx, dispatched_event);
+
+    // Keep light on if user is still interacting with the watch.
+    if (movement_state.light_ticks > 0) {
+        switch (dispatched_event.event_type) {
+            case EVENT_LIGHT_BUTTON_DOWN:
+            case EVENT_MODE_BUTTON_DOWN:
+            case EVENT_ALARM_BUTTON_DOWN:
+                movement_illuminate_led();
+        }
+    }
+
+    return can_sleep;
+}
+
 bool app_loop(void) {
-    const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
     bool woke_up_for_buzzer = false;
+
+    // whatever woke us, the tick has to run while we're awake.
+    if (movement_state.ticks_suspended) _movement_resume_ticks();
+
     if (movement_state.watch_face_changed) {
         if (movement_state.settings.bit.button_should_sound) {
             // low note for nonzero case, high note for return to watch_face 0
             watch_buzzer_play_note(movement_state.next_face_idx ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50);
         }
-        wf->resign(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_face_resign(movement_state.current_face_idx);
         movement_state.current_face_idx = movement_state.next_face_idx;
-        // we have just updated the face idx, so we must recache the watch face pointer.
-        wf = &watch_faces[movement_state.current_face_idx];
         watch_clear_display();
         movement_request_tick_frequency(1);
-        wf->activate(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_face_setup_if_needed(movement_state.current_face_idx);
+        _movement_face_activate(movement_state.current_face_idx);
         event.subsecond = 0;
         event.event_type = EVENT_ACTIVATE;
+        event_queue_stale_events = (uint8_t)(event_queue_head - event_queue_tail);
         movement_state.watch_face_changed = false;
     }
 
@@ -552,19 +1169,21 @@ bool app_loop(void) {
     // handle background tasks, if the alarm handler told us we need to
     if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
 
-    // if we have a scheduled background task, handle that here:
-    if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
-
     // if we have timed out of our low energy mode countdown, enter low energy mode.
     if (movement_state.le_mode_ticks == 0) {
         movement_state.le_mode_ticks = -1;
+        for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) face_needs_setup[i] = true;
         watch_register_extwake_callback(BTN_ALARM, cb_alarm_btn_extwake, true);
+        // from here on we wake at the top of every minute to update the display.
+        _movement_program_alarm();
         event.event_type = EVENT_NONE;
         event.subsecond = 0;
 
         // _sleep_mode_app_loop takes over at this point and loops until le_mode_ticks is reset by the extwake handler,
         // or wake is requested using the movement_request_wake function.
         _sleep_mode_app_loop();
+        wake_started_at = watch_perf_get_us();
+        wake_latency_pending = true;
         // as soon as _sleep_mode_app_loop returns, we prepare to reactivate
         // ourselves, but first, we check to see if we woke up for the buzzer:
         if (movement_state.is_buzzing) {
@@ -579,22 +1198,29 @@ bool app_loop(void) {
     // default to being allowed to sleep by the face.
     bool can_sleep = true;
 
+    // events raised here in the main loop (i.e. EVENT_ACTIVATE) go first...
     if (event.event_type) {
         event.subsecond = movement_state.subsecond;
-        // the first trip through the loop overrides the can_sleep state
-        can_sleep = wf->loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
-
-        // Keep light on if user is still interacting with the watch.
-        if (movement_state.light_ticks > 0) {
-            switch (event.event_type) {
-                case EVENT_LIGHT_BUTTON_DOWN:
-                case EVENT_MODE_BUTTON_DOWN:
-                case EVENT_ALARM_BUTTON_DOWN:
-                    movement_illuminate_led();
-            }
+        can_sleep = _movement_dispatch_event(event);
+        event.event_type = EVENT_NONE;
+        if (wake_latency_pending) {
+            wake_latency_pending = false;
+            _movement_perf_record(&wake_latency, wake_started_at);
         }
+    }
 
-        event.event_type = EVENT_NONE;
+    // ...followed by everything the interrupts queued up since the last time through. every face has to agree
+    // before we can sleep. if a face asks to move on, stop here; the rest goes to the new face on the next pass.
+    movement_event_t queued_event;
+    while (!movement_state.watch_face_changed && _movement_dequeue_event(&queued_event)) {
+        can_sleep = _movement_dispatch_event(queued_event) && can_sleep;
+    }
+
+    // ...and then the animation, if one is playing, catches up with the ticks it was counting meanwhile.
+    if (animation_playing && !movement_state.watch_face_changed) {
+        movement_event_t animation_event = { .event_type = _movement_animation_catch_up(), .subsecond = movement_state.subsecond };
+        if (animation_event.event_type) can_sleep = _movement_dispatch_event(animation_event) && can_sleep;
+        if (animation_playing && animation_ticks_handled != animation_ticks_elapsed) can_sleep = false;
     }
 
     // if we have timed out of our timeout countdown, give the app a hint that they can resign.
@@ -612,7 +1238,7 @@ bool app_loop(void) {
         // first trip  | can sleep | cannot sleep | can sleep    | cannot sleep
         // second trip | can sleep | cannot sleep | cannot sleep | can sleep
         //          && | can sleep | cannot sleep | cannot sleep | cannot sleep
-        bool can_sleep2 = wf->loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        bool can_sleep2 = _movement_face_loop(movement_state.current_face_idx, event);
         can_sleep = can_sleep && can_sleep2;
         event.event_type = EVENT_NONE;
         if (movement_state.settings.bit.to_always && movement_state.current_face_idx != 0) {
@@ -621,31 +1247,15 @@ bool app_loop(void) {
         }
     }
 
-    // Now that we've handled all display update tasks, handle the alarm.
-    if (movement_state.alarm_ticks >= 0) {
-        uint8_t buzzer_phase = (movement_state.alarm_ticks + 80) % 128;
-        if(buzzer_phase == 127) {
-            // failsafe: buzzer could have been disabled in the meantime
-            if (!watch_is_buzzer_or_led_enabled()) watch_enable_buzzer();
-            // play 4 beeps plus pause
-            for(uint8_t i = 0; i < 4; i++) {
-                // TODO: This method of playing the buzzer blocks the UI while it's beeping.
-                // It might be better to time it with the fast tick.
-                watch_buzzer_play_note(movement_state.alarm_note, (i != 3) ? 50 : 75);
-                if (i != 3) watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
-            }
-        }
-        if (movement_state.alarm_ticks == 0) {
-            movement_state.alarm_ticks = -1;
-            _movement_disable_fast_tick_if_possible();
-        }
-    }
-
     // if we are plugged into USB, handle the serial shell
     if (watch_is_usb_enabled()) {
         shell_task();
     }
 
+    // write out one of the file writes the faces queued, and come straight back for the next one if there are
+    // more, so that a button press never has to wait for more than one of them.
+    if (filesystem_service()) can_sleep = false;
+
     event.subsecond = 0;
 
     // if the watch face changed, we can't sleep because we need to update the display.
@@ -659,28 +1269,32 @@ bool app_loop(void) {
     // if the LED is on, we need to stay awake to keep the TCC running.
     if (movement_state.light_ticks != -1) can_sleep = false;
 
+    // if the face told us when its display next changes, sleep through the ticks until then.
+    if (can_sleep && movement_state.le_mode_ticks != -1) _movement_suspend_ticks_if_possible();
+
     return can_sleep;
 }
 
 static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, uint16_t *down_timestamp) {
     // force alarm off if the user pressed a button.
-    if (movement_state.alarm_ticks) movement_state.alarm_ticks = 0;
+    if (movement_state.alarm_playing) _movement_stop_alarm();
 
     if (pin_level) {
         // handle rising edge
-        _movement_enable_fast_tick_if_needed();
-        *down_timestamp = movement_state.fast_ticks + 1;
+        _movement_enable_button_timer_if_needed();
+        *down_timestamp = movement_state.button_ticks + 1;
         return button_down_event_type;
     } else {
         // this line is hack but it handles the situation where the light button was held for more than 20 seconds.
         // fast tick is disabled by then, and the LED would get stuck on since there's no one left decrementing light_ticks.
         if (movement_state.light_ticks == 1) movement_state.light_ticks = 0;
         // now that that's out of the way, handle falling edge
-        uint16_t diff = movement_state.fast_ticks - *down_timestamp;
+        bool long_press = (*down_timestamp == MOVEMENT_BUTTON_LONG_PRESSED) ||
+                          (*down_timestamp != 0 && _movement_button_ticks_held(*down_timestamp) >= MOVEMENT_LONG_PRESS_TICKS);
         *down_timestamp = 0;
-        _movement_disable_fast_tick_if_possible();
+        _movement_disable_button_timer_if_possible();
         // any press over a half second is considered a long press. Fire the long-up event
-        if (diff > MOVEMENT_LONG_PRESS_TICKS) return button_down_event_type + 3;
+        if (long_press) return button_down_event_type + 3;
         else return button_down_event_type + 1;
     }
 }
@@ -688,19 +1302,19 @@ static movement_event_type_t _figure_out_button_event(bool pin_level, movement_e
 void cb_light_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_LIGHT);
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp);
+    _movement_queue_event(_figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp));
 }
 
 void cb_mode_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_MODE);
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp);
+    _movement_queue_event(_figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp));
 }
 
 void cb_alarm_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_ALARM);
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp);
+    _movement_queue_event(_figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp));
 }
 
 void cb_alarm_btn_extwake(void) {
@@ -712,23 +1326,30 @@ void cb_alarm_fired(void) {
     movement_state.needs_background_tasks_handled = true;
 }
 
+static void _movement_check_long_press(uint16_t *down_timestamp, movement_event_type_t long_press_event_type) {
+    if (_movement_button_is_being_timed(*down_timestamp) && _movement_button_ticks_held(*down_timestamp) == MOVEMENT_LONG_PRESS_TICKS) {
+        *down_timestamp = MOVEMENT_BUTTON_LONG_PRESSED;
+        _movement_queue_event(long_press_event_type);
+    }
+}
+
+static void _movement_button_tick(void) {
+    movement_state.button_ticks++;
+    // check timestamps and auto-fire the long-press events
+    _movement_check_long_press(&movement_state.light_down_timestamp, EVENT_LIGHT_LONG_PRESS);
+    _movement_check_long_press(&movement_state.mode_down_timestamp, EVENT_MODE_LONG_PRESS);
+    _movement_check_long_press(&movement_state.alarm_down_timestamp, EVENT_ALARM_LONG_PRESS);
+    _movement_disable_button_timer_if_possible();
+}
+
+void cb_button_tick(void) {
+    _movement_button_tick();
+}
+
 void cb_fast_tick(void) {
     movement_state.fast_ticks++;
     if (movement_state.light_ticks > 0) movement_state.light_ticks--;
-    if (movement_state.alarm_ticks > 0) movement_state.alarm_ticks--;
-    // check timestamps and auto-fire the long-press events
-    // Notice: is it possible that two or more buttons have an identical timestamp? In this case
-    // only one of these buttons would receive the long press event. Don't bother for now...
-    if (movement_state.light_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_LIGHT_LONG_PRESS;
-    if (movement_state.mode_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_MODE_LONG_PRESS;
-    if (movement_state.alarm_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_ALARM_LONG_PRESS;
-    // this is just a fail-safe; fast tick should be disabled as soon as the button is up, the LED times out, and/or the alarm finishes.
+    // this is just a fail-safe; fast tick should be disabled as soon as the LED times out.
     // but if for whatever reason it isn't, this forces the fast tick off after 20 seconds.
     if (movement_state.fast_ticks >= 128 * 20) {
         watch_rtc_disable_periodic_callback(128);
@@ -737,7 +1358,6 @@ void cb_fast_tick(void) {
 }
 
 void cb_tick(void) {
-    event.event_type = EVENT_TICK;
     watch_date_time date_time = watch_rtc_get_date_time();
     if (date_time.unit.second != movement_state.last_second) {
         // TODO: can we consolidate these two ticks?
@@ -749,4 +1369,7 @@ void cb_tick(void) {
     } else {
         movement_state.subsecond++;
     }
+    if (animation_playing) animation_ticks_elapsed++;
+    else _movement_queue_event(EVENT_TICK);
+    if (movement_state.button_timer_enabled && movement_state.tick_frequency == MOVEMENT_BUTTON_TICK_FREQUENCY) _movement_button_tick();
 }
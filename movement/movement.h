@@ -121,6 +121,9 @@ typedef enum {
     EVENT_ALARM_BUTTON_UP,      // The alarm button was pressed for less than half a second, and released.
     EVENT_ALARM_LONG_PRESS,     // The alarm button was held for over half a second, but not yet released.
     EVENT_ALARM_LONG_UP,        // The alarm button was held for over half a second, and released.
+    EVENT_ANIMATION_KEYFRAME,   // The animation you started with movement_play_animation has just shown a keyframe.
+    EVENT_ANIMATION_DONE,       // The animation you started with movement_play_animation has played its last frame.
+    EVENT_TIME_CHANGED,         // The clock was set. Only sent if you asked with movement_request_time_changed_events; like a background task, you may not be in the foreground.
 } movement_event_type_t;
 
 typedef struct {
@@ -215,6 +218,10 @@ typedef void (*watch_face_resign)(movement_settings_t *settings, void *context);
   *          immediately call your loop function with an EVENT_BACKGROUND_TASK event. Note that it will not call your
   *          activate or deactivate functions, since you are not going on screen.
   *
+  *          If you know ahead of time when you will need to run, prefer movement_schedule_background_task_for_face
+  *          and leave this function NULL. As long as any face provides this function, Movement has to wake the
+  *          watch every minute to poll it; scheduled tasks only wake the watch when they are due.
+  *
   *          Examples of background tasks:
   *           - Wake and play a sound when an alarm or timer has been triggered.
   *           - Check the state of an RTC interrupt pin or the timestamp of an RTC interrupt event.
@@ -255,11 +262,12 @@ typedef struct {
     int16_t light_ticks;
 
     // alarm stuff
-    int16_t alarm_ticks;
     bool is_buzzing;
-    BuzzerNote alarm_note;
+    bool alarm_playing;     // the alarm beeps are playing; any button press stops them
 
     // button tracking for long press
+    bool button_timer_enabled;
+    uint16_t button_ticks;
     uint16_t light_down_timestamp;
     uint16_t mode_down_timestamp;
     uint16_t alarm_down_timestamp;
@@ -267,6 +275,9 @@ typedef struct {
     // background task handling
     bool needs_background_tasks_handled;
     bool has_scheduled_background_task;
+    watch_date_time next_scheduled_task;
+    bool has_polling_faces;
+    uint8_t last_polled_minute;
     bool needs_wake;
 
     // low energy mode countdown
@@ -275,6 +286,11 @@ typedef struct {
     // app resignation countdown (TODO: consolidate with LE countdown?)
     int16_t timeout_ticks;
 
+    // tick suppression for faces that know when their display next changes
+    watch_date_time next_redraw;
+    bool ticks_suspended;
+    uint32_t ticks_suspended_at;
+
     // stuff for subsecond tracking
     uint8_t tick_frequency;
     uint8_t last_second;
@@ -291,8 +307,166 @@ bool movement_default_loop_handler(movement_event_t event, movement_settings_t *
 
 void movement_illuminate_led(void);
 
+typedef struct {
+    uint8_t depth;          // events waiting to be handled right now
+    uint8_t capacity;       // how many events the queue can hold
+    uint8_t high_water;     // the most events that have ever been waiting at once
+    uint16_t overflows;     // events lost because the queue was full
+    uint16_t drops;         // stale events discarded on purpose, i.e. ticks queued for a face that has since resigned
+} movement_event_queue_stats_t;
+
+/// Returns counters for the queue that carries button and tick events from interrupt context to app_loop.
+movement_event_queue_stats_t movement_get_event_queue_stats(void);
+
+/** @brief Allocates memory for a watch face's context. Call this from your setup function instead of malloc.
+  * @details Contexts come out of a fixed arena sized by MOVEMENT_CONTEXT_ARENA_SIZE, which avoids the heap's
+  *          bookkeeping and fragmentation, and lets Movement report how much memory each face uses. The memory is
+  *          zeroed, and it is never freed, so only allocate it once (i.e. when *context_ptr is NULL).
+  *          The arena is sized at build time from the faces in movement_config.h, so your face's header needs to
+  *          say how much it allocates: next to your state struct, define YOUR_FACE_CONTEXT_SIZE as the sum of
+  *          MOVEMENT_CONTEXT_SIZE(size) for each allocation, or 0 if it makes none.
+  * @param size The number of bytes you need.
+  * @return A pointer to the memory, or NULL if the arena is full. That means some face allocates more than its
+  *         header says; Movement prints which one.
+  */
+void *movement_alloc_context(size_t size);
+
+/// The room that movement_alloc_context takes for an allocation of the given size. It rounds up to 8 bytes, so that
+/// anything can be stored in the memory.
+#define MOVEMENT_CONTEXT_SIZE(size) (((size) + 7) & ~(size_t)7)
+
+/** @brief Allocates a temporary buffer that lasts until the current watch face resigns.
+  * @details This is for things like file contents that you only need while your face is on screen. The memory is
+  *          not zeroed, and you don't free it; Movement takes it all back after your resign function returns.
+  * @param size The number of bytes you need. All allocations together have to fit in MOVEMENT_SCRATCH_SIZE.
+  * @return A pointer to the memory, or NULL if there isn't enough room. You must check for this.
+  */
+void *movement_alloc_scratch(size_t size);
+
+typedef struct {
+    uint16_t arena_used;            // bytes handed out from the context arena
+    uint16_t arena_size;            // MOVEMENT_CONTEXT_ARENA_SIZE
+    uint16_t scratch_used;          // bytes of scratch the current face is holding
+    uint16_t scratch_size;          // MOVEMENT_SCRATCH_SIZE
+    uint16_t scratch_high_water;    // the most scratch that any face has held at once
+} movement_memory_stats_t;
+
+/// Returns how much of Movement's context arena and scratch space is in use.
+movement_memory_stats_t movement_get_memory_stats(void);
+
+/** @brief Returns the number of bytes a watch face has allocated with movement_alloc_context.
+  * @return false if there is no face at that index.
+  */
+bool movement_get_context_bytes(uint8_t watch_face_index, uint16_t *bytes);
+
+typedef enum {
+    MOVEMENT_PERF_SETUP = 0,
+    MOVEMENT_PERF_ACTIVATE,
+    MOVEMENT_PERF_LOOP,
+    MOVEMENT_PERF_RESIGN,
+    MOVEMENT_PERF_WANTS_BACKGROUND_TASK,
+    MOVEMENT_NUM_PERF_CALLS
+} movement_perf_call_t;
+
+typedef struct {
+    uint32_t calls;         // times the function was called
+    uint32_t total_us;      // time spent in it over all of those calls
+    uint32_t max_us;        // the longest single call
+} movement_perf_counter_t;
+
+/** @brief Returns how much time one of a watch face's functions has taken, since boot or the last reset.
+  * @param watch_face_index The face's index in the watch_faces array.
+  * @param call Which of the face's functions you are interested in.
+  * @param counter Receives the call count and timings.
+  * @return false if there is no face at that index.
+  */
+bool movement_get_perf_counter(uint8_t watch_face_index, movement_perf_call_t call, movement_perf_counter_t *counter);
+
+/// Returns how long it took to get from leaving low energy mode to the current face's first frame, over all such wakes.
+movement_perf_counter_t movement_get_wake_latency(void);
+
+/// Returns the number of seconds of wall clock time covered by the perf counters, i.e. since boot or the last reset.
+uint32_t movement_get_perf_elapsed_seconds(void);
+
+/// Resets the per-face perf counters, along with the watch library's count of wakes, awake time and display work.
+void movement_reset_perf_counters(void);
+
 void movement_request_tick_frequency(uint8_t freq);
 
+/** @brief Tells Movement that the current face's display won't change again until the given time.
+  * @details Movement will stop the 1 Hz tick and let the watch sleep until then, waking early only for buttons and
+  *          background tasks. At that time the face gets an ordinary EVENT_TICK. The request is dropped on the
+  *          next button press, face change or tick frequency change, so call it again each time you redraw.
+  *          It has no effect at tick frequencies other than 1 Hz.
+  */
+void movement_request_next_redraw(watch_date_time date_time);
+
+/// In a movement_animation_step_t, the COM value that changes no segment, for a frame that only marks time.
+#define MOVEMENT_ANIMATION_NO_SEGMENT 3
+
+/** @brief One change in an animation: a segment to light or clear, and how long to wait before the next change.
+  * @details A frame is a run of steps whose ticks are all 0 except for the last, which says how many ticks the
+  *          frame stays up. The com and seg values are the same ones watch_set_pixel takes.
+  */
+typedef struct {
+    uint8_t seg : 6;        // the segment to change...
+    uint8_t com : 2;        // ...on this COM line, or MOVEMENT_ANIMATION_NO_SEGMENT to change nothing.
+    uint8_t on : 1;         // true to light the segment, false to clear it.
+    uint8_t keyframe : 1;   // true to send the face EVENT_ANIMATION_KEYFRAME when this step's frame goes up.
+    uint8_t ticks : 6;      // 0 if the next step is part of the same frame; otherwise, ticks to show the frame for.
+} movement_animation_step_t;
+
+/** @brief Appends the steps that turn one frame into another, as one frame of an animation.
+  * @details A handy way to build an animation is to draw each frame as usual, capture it with
+  *          watch_display_capture_frame, and have this work out what changed since the frame before.
+  * @param from The frame the display will be showing beforehand.
+  * @param to The frame to change it to.
+  * @param steps Where to write the steps.
+  * @param max_steps How many steps there is room for.
+  * @param ticks How many ticks to show the new frame for, 1-63.
+  * @param keyframe true to send the face EVENT_ANIMATION_KEYFRAME when the new frame goes up.
+  * @return The number of steps written, or 0 if they didn't fit. A frame that changes nothing takes one step.
+  */
+uint16_t movement_animation_add_frame(const watch_display_frame_t *from, const watch_display_frame_t *to,
+                                      movement_animation_step_t *steps, uint16_t max_steps, uint8_t ticks, bool keyframe);
+
+/** @brief Plays a precomputed animation on the display, without calling the face for every frame.
+  * @details Movement sets the tick frequency to freq and shows the first frame right away. From then on, the
+  *          tick interrupt only counts ticks, and the main loop draws each frame as it comes due without calling
+  *          the face; in place of EVENT_TICK, the face only hears about keyframes, and gets EVENT_ANIMATION_DONE
+  *          once the last frame's ticks are up (unless the animation loops). After that, ticks come in as usual
+  *          at freq.
+  *          While an animation plays, the display belongs to it. To draw something of your own, call
+  *          movement_stop_animation first, and movement_resume_animation when you're done.
+  *          Changing the tick frequency, or moving to another face, stops the animation for good.
+  * @param steps The changes that make up the animation. Movement doesn't copy them, so they have to stay put
+  *              (in your context, or const) until the animation is done.
+  * @param num_steps The number of steps.
+  * @param freq The tick frequency to play at. Like movement_request_tick_frequency, up to 64 Hz.
+  * @param loop true to start over from the first step after the last one, rather than stopping.
+  */
+void movement_play_animation(const movement_animation_step_t *steps, uint16_t num_steps, uint8_t freq, bool loop);
+
+/// Stops the animation where it is, leaving its current frame on the display. Ticks come in as usual meanwhile.
+void movement_stop_animation(void);
+
+/// Carries on with an animation that was stopped with movement_stop_animation.
+void movement_resume_animation(void);
+
+/// Returns true if an animation is playing.
+bool movement_animation_is_playing(void);
+
+/// Returns which keyframe the animation showed last, counting from 0 when it started (and on through any loops).
+uint16_t movement_get_animation_keyframe(void);
+
+typedef struct {
+    uint32_t frames;                // frames the animation engine has drawn
+    movement_perf_counter_t ticks;  // the passes of the main loop it drew frames in, and the time it spent on them
+} movement_animation_stats_t;
+
+/// Returns how much work animations have done since boot or the last call to movement_reset_perf_counters.
+movement_animation_stats_t movement_get_animation_stats(void);
+
 // note: watch faces can only schedule a background task when in the foreground, since
 // movement will associate the scheduled task with the currently active face.
 void movement_schedule_background_task(watch_date_time date_time);
@@ -302,11 +476,34 @@ void movement_schedule_background_task(watch_date_time date_time);
 void movement_cancel_background_task(void);
 
 // these functions should work around the limitation of the above functions, which will be deprecated.
+// a face gets one scheduled task at a time; scheduling another replaces it. Movement sets the RTC alarm for the
+// earliest one, and calls the face's loop with EVENT_BACKGROUND_TASK once it comes due, in any power mode.
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time date_time);
 void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 
+/** @brief Sets the RTC. Faces that set the time should use this rather than calling watch_rtc_set_date_time.
+  * @details Scheduled background tasks are left where they are: a deadline names a moment on the clock, so one
+  *          that the clock was set past comes due right away, and one it was set back from comes due that much
+  *          later. A face whose deadline is worked out from the time of day (like an hourly chime) should ask for
+  *          EVENT_TIME_CHANGED with movement_request_time_changed_events, and schedule it again from there.
+  */
+void movement_set_date_time(watch_date_time date_time);
+
+/** @brief Asks Movement to call the face's loop with EVENT_TIME_CHANGED whenever movement_set_date_time sets the
+  *        clock. Call it from your setup function. The event comes on the next pass of the main loop, before any
+  *        background tasks the change made due.
+  * @param watch_face_index The face's index in watch_faces.
+  */
+void movement_request_time_changed_events(uint8_t watch_face_index);
+
 void movement_request_wake(void);
 
+// in low energy mode, a face can hand Movement the next several minutes of its display while handling
+// EVENT_LOW_ENERGY_UPDATE: frames[0] for the current minute, and one frame for each minute after, captured with
+// watch_display_capture_frame. Movement puts frames[0] up, and as long as nothing else needs the RTC alarm before
+// they run out, leaves the SLCD to step through the rest while it sleeps, waking only once the last one is up.
+void movement_set_low_energy_frames(const watch_display_frame_t *frames, uint8_t num_frames);
+
 void movement_play_signal(void);
 void movement_play_alarm(void);
 void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note);
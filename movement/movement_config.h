@@ -27,11 +27,28 @@
 
 #include "movement_faces.h"
 
-/* watch_faces is defined and filled at runtime in movement.c */
+/* watch_faces is defined in movement.c */
 extern watch_face_t watch_faces[];
 
 #define MOVEMENT_NUM_FACES 10
 
+/* Room for the contexts of the faces in watch_faces, which come from a fixed arena and are never freed.
+ * Each face's header says how much it allocates; if you change the faces in movement.c, list the same ones here.
+ * A face that allocates more than its header says gets NULL, and Movement prints a message naming it.
+ */
+#define MOVEMENT_CONTEXT_ARENA_SIZE ( \
+    SIMPLE_CLOCK_FACE_CONTEXT_SIZE + \
+    GOAL_TRACKER_FACE_CONTEXT_SIZE + \
+    WORLD_CLOCK_FACE_CONTEXT_SIZE + \
+    SUNRISE_SUNSET_FACE_CONTEXT_SIZE + \
+    MOON_PHASE_FACE_CONTEXT_SIZE + \
+    STOPWATCH_FACE_CONTEXT_SIZE + \
+    PREFERENCES_FACE_CONTEXT_SIZE + \
+    SET_TIME_FACE_CONTEXT_SIZE + \
+    THERMISTOR_READOUT_FACE_CONTEXT_SIZE + \
+    VOLTAGE_FACE_CONTEXT_SIZE \
+)
+
 /* Determines what face to go to from the first face on long press of the Mode button.
  * Also excludes these faces from the normal rotation.
  * In the default firmware, this lets you access temperature and battery voltage with a long press of Mode.
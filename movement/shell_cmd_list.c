@@ -27,13 +27,18 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "filesystem.h"
+#include "movement.h"
 #include "watch.h"
 
 static int help_cmd(int argc, char *argv[]);
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int events_cmd(int argc, char *argv[]);
+static int perf_cmd(int argc, char *argv[]);
+static int mem_cmd(int argc, char *argv[]);
 
 shell_command_t g_shell_commands[] = {
     {
@@ -99,6 +104,13 @@ shell_command_t g_shell_commands[] = {
         .max_args = 3,
         .cb = filesystem_cmd_echo,
     },
+    {
+        .name = "sync",
+        .help = "write out any queued file writes",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = filesystem_cmd_sync,
+    },
     {
         .name = "stress",
         .help = "test CDC write; usage: stress [LEN] [DELAY_MS]",
@@ -106,6 +118,27 @@ shell_command_t g_shell_commands[] = {
         .max_args = 2,
         .cb = stress_cmd,
     },
+    {
+        .name = "events",
+        .help = "print event queue statistics",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = events_cmd,
+    },
+    {
+        .name = "perf",
+        .help = "usage: perf [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = perf_cmd,
+    },
+    {
+        .name = "mem",
+        .help = "print watch face memory usage",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = mem_cmd,
+    },
 };
 
 const size_t g_num_shell_commands = sizeof(g_shell_commands) / sizeof(shell_command_t);
@@ -129,6 +162,7 @@ static int flash_cmd(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
 
+    filesystem_flush();
     watch_reset_to_bootloader();
     return 0;
 }
@@ -163,3 +197,84 @@ static int stress_cmd(int argc, char *argv[]) {
 
     return 0;
 }
+
+static int events_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    movement_event_queue_stats_t stats = movement_get_event_queue_stats();
+    printf("queued:     %u of %u\r\n", stats.depth, stats.capacity);
+    printf("high water: %u\r\n", stats.high_water);
+    printf("overflows:  %u\r\n", stats.overflows);
+    printf("dropped:    %u\r\n", stats.drops);
+
+    return 0;
+}
+
+static int perf_cmd(int argc, char *argv[]) {
+    static const char *call_names[MOVEMENT_NUM_PERF_CALLS] = {
+        "setup",
+        "activate",
+        "loop",
+        "resign",
+        "wants_bg",
+    };
+
+    if (argc == 2) {
+        if (strcmp(argv[1], "reset") != 0) return -2;
+        movement_reset_perf_counters();
+        return 0;
+    }
+
+    printf("face call          calls   total_us   max_us\r\n");
+    movement_perf_counter_t counter;
+    for (uint8_t i = 0; movement_get_perf_counter(i, 0, &counter); i++) {
+        for (movement_perf_call_t call = 0; call < MOVEMENT_NUM_PERF_CALLS; call++) {
+            movement_get_perf_counter(i, call, &counter);
+            if (counter.calls == 0) continue;
+            printf("%4u %-9s %9lu %10lu %8lu\r\n", i, call_names[call],
+                   (unsigned long)counter.calls, (unsigned long)counter.total_us, (unsigned long)counter.max_us);
+        }
+    }
+
+    // integer math only; printf may not have float support on the watch.
+    watch_perf_stats_t stats = watch_perf_get_stats();
+    uint32_t elapsed = movement_get_perf_elapsed_seconds();
+    uint32_t awake_ms = (uint32_t)(stats.awake_us / 1000);
+    // in hundredths of a percent: awake_us / (elapsed * 1000000) * 10000
+    uint32_t awake_permyriad = elapsed ? (uint32_t)(stats.awake_us / ((uint64_t)elapsed * 100)) : 0;
+    uint32_t wakes_per_hour = elapsed ? (uint32_t)((uint64_t)stats.wakes * 3600 / elapsed) : 0;
+    printf("awake:      %lu ms in %lu s (%lu.%02lu%%)\r\n", (unsigned long)awake_ms, (unsigned long)elapsed,
+           (unsigned long)(awake_permyriad / 100), (unsigned long)(awake_permyriad % 100));
+    printf("wakes:      %lu (%lu per hour)\r\n", (unsigned long)stats.wakes, (unsigned long)wakes_per_hour);
+    movement_perf_counter_t latency = movement_get_wake_latency();
+    printf("le wakes:   %lu, %lu us to first frame on average, %lu us at most\r\n", (unsigned long)latency.calls,
+           (unsigned long)(latency.calls ? latency.total_us / latency.calls : 0), (unsigned long)latency.max_us);
+    watch_display_stats_t display = watch_display_get_stats();
+    printf("display:    %lu frames, %lu register writes, %lu characters drawn, %lu skipped\r\n",
+           (unsigned long)display.commits, (unsigned long)display.register_writes,
+           (unsigned long)display.characters_drawn, (unsigned long)display.characters_skipped);
+    movement_animation_stats_t animation = movement_get_animation_stats();
+    printf("animation:  %lu frames over %lu ticks, %lu us in the tick interrupt, %lu us at most\r\n",
+           (unsigned long)animation.frames, (unsigned long)animation.ticks.calls,
+           (unsigned long)animation.ticks.total_us, (unsigned long)animation.ticks.max_us);
+
+    return 0;
+}
+
+static int mem_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    printf("face  context\r\n");
+    uint16_t bytes;
+    for (uint8_t i = 0; movement_get_context_bytes(i, &bytes); i++) {
+        printf("%4u %8u\r\n", i, bytes);
+    }
+
+    movement_memory_stats_t stats = movement_get_memory_stats();
+    printf("arena:      %u of %u bytes\r\n", stats.arena_used, stats.arena_size);
+    printf("scratch:    %u of %u bytes, at most %u\r\n", stats.scratch_used, stats.scratch_size, stats.scratch_high_water);
+
+    return 0;
+}
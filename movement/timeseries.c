@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "timeseries.h"
+#include "filesystem.h"
+
+// on flash, a segment is its sequence number, followed by the records: each one its timestamp and record_size bytes.
+#define TIMESERIES_SEQUENCE_SIZE sizeof(uint32_t)
+#define TIMESERIES_TIMESTAMP_SIZE sizeof(uint32_t)
+
+static inline uint8_t _timeseries_record_bytes(timeseries_t *series) {
+    return TIMESERIES_TIMESTAMP_SIZE + series->record_size;
+}
+
+// the segment holding the nth oldest group of records.
+static inline uint8_t _timeseries_segment(timeseries_t *series, uint8_t n) {
+    return (series->oldest + n) % series->num_segments;
+}
+
+static void _timeseries_path(timeseries_t *series, uint8_t segment, char *path) {
+    sprintf(path, "%s.%u", series->name, segment);
+}
+
+bool timeseries_init(timeseries_t *series, const char *name, uint8_t record_size, uint8_t records_per_segment, uint8_t num_segments) {
+    memset(series, 0, sizeof(timeseries_t));
+    if (strlen(name) > TIMESERIES_MAX_NAME_LENGTH) return false;
+    if (TIMESERIES_TIMESTAMP_SIZE + record_size > TIMESERIES_BUFFER_SIZE) return false;
+    if (records_per_segment == 0 || num_segments < 2 || num_segments > TIMESERIES_MAX_SEGMENTS) return false;
+    series->name = name;
+    series->record_size = record_size;
+    series->records_per_segment = records_per_segment;
+    series->num_segments = num_segments;
+
+    // load the index: how many records each segment holds, and the timestamp it starts at.
+    char path[TIMESERIES_MAX_NAME_LENGTH + 3];
+    uint32_t sequences[TIMESERIES_MAX_SEGMENTS];
+    bool found = false;
+    uint8_t newest = 0;
+    for (uint8_t segment = 0; segment < num_segments; segment++) {
+        uint32_t header[2];
+        _timeseries_path(series, segment, path);
+        int32_t size = filesystem_get_file_size(path) - (int32_t)TIMESERIES_SEQUENCE_SIZE;
+        if (size < (int32_t)_timeseries_record_bytes(series)) continue;
+        if (!filesystem_read_file(path, (char *)header, sizeof(header))) continue;
+        sequences[segment] = header[0];
+        series->first_timestamps[segment] = header[1];
+        series->counts[segment] = min(size / _timeseries_record_bytes(series), records_per_segment);
+        if (!found || sequences[segment] > sequences[newest]) newest = segment;
+        found = true;
+    }
+    if (!found) return true;
+
+    // segments are used in order, so the series is the run of segments that ends at the newest one. anything
+    // outside of that run is left over from an interrupted eviction, and gets overwritten in time.
+    series->sequence = sequences[newest];
+    series->oldest = newest;
+    series->used = 1;
+    while (series->used < num_segments) {
+        uint8_t previous = (series->oldest + num_segments - 1) % num_segments;
+        if (series->counts[previous] == 0 || sequences[previous] != sequences[series->oldest] - 1) break;
+        series->oldest = previous;
+        series->used++;
+    }
+    for (uint8_t n = series->used; n < num_segments; n++) series->counts[_timeseries_segment(series, n)] = 0;
+
+    // appends can't go back before the newest record.
+    timeseries_read(series, timeseries_count(series) - 1, 1, &series->last_timestamp, NULL);
+
+    return true;
+}
+
+bool timeseries_flush(timeseries_t *series) {
+    if (series->pending == 0) return true;
+
+    char path[TIMESERIES_MAX_NAME_LENGTH + 3];
+    uint8_t newest = _timeseries_segment(series, series->used - 1);
+    // a segment's first write creates its file, and puts the sequence number in front of its records.
+    bool starts_segment = series->counts[newest] == series->pending;
+    _timeseries_path(series, newest, path);
+    int flags = starts_segment ? LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC : LFS_O_WRONLY | LFS_O_APPEND;
+    filesystem_file_t file = filesystem_open(path, flags);
+    if (file == FILESYSTEM_NO_FILE) return false;
+
+    int32_t length = series->pending * _timeseries_record_bytes(series);
+    bool success = true;
+    if (starts_segment) {
+        success = filesystem_write(file, &series->sequence, TIMESERIES_SEQUENCE_SIZE) == TIMESERIES_SEQUENCE_SIZE;
+    }
+    success = success && filesystem_write(file, series->buf, length) == length;
+    success = filesystem_close(file) && success;
+    if (success) series->pending = 0;
+
+    return success;
+}
+
+bool timeseries_append(timeseries_t *series, uint32_t timestamp, const void *record) {
+    uint8_t record_bytes = _timeseries_record_bytes(series);
+
+    // if the clock was set back, the record goes in at the time of the newest one, so the series stays in order.
+    if (timestamp < series->last_timestamp) timestamp = series->last_timestamp;
+
+    // the buffer is written out as soon as it fills, so it only lacks room here if that failed; try again.
+    if ((series->pending + 1) * record_bytes > TIMESERIES_BUFFER_SIZE && !timeseries_flush(series)) return false;
+
+    uint8_t newest = _timeseries_segment(series, series->used - 1);
+    if (series->used == 0 || series->counts[newest] == series->records_per_segment) {
+        // start a new segment, making room for it if every segment is in use.
+        char path[TIMESERIES_MAX_NAME_LENGTH + 3];
+        if (!timeseries_flush(series)) return false;
+        if (series->used == series->num_segments) {
+            _timeseries_path(series, series->oldest, path);
+            filesystem_rm(path);
+            series->counts[series->oldest] = 0;
+            series->oldest = _timeseries_segment(series, 1);
+            series->used--;
+        }
+        newest = _timeseries_segment(series, series->used);
+        _timeseries_path(series, newest, path);
+        if (filesystem_file_exists(path)) filesystem_rm(path);
+        series->used++;
+        series->sequence++;
+        series->counts[newest] = 0;
+        series->first_timestamps[newest] = timestamp;
+    }
+
+    uint8_t *dest = series->buf + series->pending * record_bytes;
+    memcpy(dest, &timestamp, TIMESERIES_TIMESTAMP_SIZE);
+    memcpy(dest + TIMESERIES_TIMESTAMP_SIZE, record, series->record_size);
+    series->pending++;
+    series->counts[newest]++;
+    series->last_timestamp = timestamp;
+
+    // write out a whole page at a time, or whatever is left when the segment fills. if that fails, the record
+    // is still stored, and the next append or flush tries again.
+    if ((series->pending + 1) * record_bytes > TIMESERIES_BUFFER_SIZE || series->counts[newest] == series->records_per_segment) {
+        timeseries_flush(series);
+    }
+
+    return true;
+}
+
+uint32_t timeseries_count(timeseries_t *series) {
+    uint32_t count = 0;
+    for (uint8_t n = 0; n < series->used; n++) count += series->counts[_timeseries_segment(series, n)];
+
+    return count;
+}
+
+uint32_t timeseries_read(timeseries_t *series, uint32_t index, uint32_t count, uint32_t *timestamps, void *records) {
+    uint8_t record_bytes = _timeseries_record_bytes(series);
+    uint8_t record_buf[TIMESERIES_BUFFER_SIZE];
+    char path[TIMESERIES_MAX_NAME_LENGTH + 3];
+    uint32_t num_read = 0;
+
+    // skip to the segment holding the first record.
+    uint8_t n = 0;
+    while (n < series->used && index >= series->counts[_timeseries_segment(series, n)]) {
+        index -= series->counts[_timeseries_segment(series, n)];
+        n++;
+    }
+
+    for (; n < series->used && num_read < count; n++, index = 0) {
+        uint8_t segment = _timeseries_segment(series, n);
+        uint8_t in_segment = series->counts[segment];
+        // the newest segment's last few records may still be in the buffer.
+        uint8_t on_flash = (n == series->used - 1) ? in_segment - series->pending : in_segment;
+        filesystem_file_t file = FILESYSTEM_NO_FILE;
+        bool success = true;
+
+        for (; index < in_segment && num_read < count; index++, num_read++) {
+            const uint8_t *source;
+            if (index < on_flash) {
+                if (file == FILESYSTEM_NO_FILE) {
+                    _timeseries_path(series, segment, path);
+                    file = filesystem_open(path, LFS_O_RDONLY);
+                    if (file == FILESYSTEM_NO_FILE) return num_read;
+                    success = filesystem_seek(file, TIMESERIES_SEQUENCE_SIZE + index * record_bytes, LFS_SEEK_SET) >= 0;
+                }
+                success = success && filesystem_read(file, record_buf, record_bytes) == record_bytes;
+                if (!success) break;
+                source = record_buf;
+            } else {
+                source = series->buf + (index - on_flash) * record_bytes;
+            }
+            if (timestamps != NULL) memcpy(&timestamps[num_read], source, TIMESERIES_TIMESTAMP_SIZE);
+            if (records != NULL) memcpy((uint8_t *)records + num_read * series->record_size, source + TIMESERIES_TIMESTAMP_SIZE, series->record_size);
+        }
+
+        if (file != FILESYSTEM_NO_FILE) filesystem_close(file);
+        if (!success) break;
+    }
+
+    return num_read;
+}
+
+uint32_t timeseries_find(timeseries_t *series, uint32_t timestamp) {
+    // first, find the first segment that starts at or after the timestamp, using the index.
+    uint8_t low = 0, high = series->used;
+    while (low < high) {
+        uint8_t mid = (low + high) / 2;
+        if (series->first_timestamps[_timeseries_segment(series, mid)] < timestamp) low = mid + 1;
+        else high = mid;
+    }
+    if (low == 0) return 0;
+
+    // the record we want is then either in the segment before that one, or is the first record of that one.
+    uint32_t base = 0;
+    for (uint8_t n = 0; n < low - 1; n++) base += series->counts[_timeseries_segment(series, n)];
+    uint32_t first = 1, last = series->counts[_timeseries_segment(series, low - 1)];
+    while (first < last) {
+        uint32_t mid = (first + last) / 2;
+        uint32_t mid_timestamp;
+        if (timeseries_read(series, base + mid, 1, &mid_timestamp, NULL) != 1) break;
+        if (mid_timestamp < timestamp) first = mid + 1;
+        else last = mid;
+    }
+
+    return base + first;
+}
+
+void timeseries_clear(timeseries_t *series) {
+    char path[TIMESERIES_MAX_NAME_LENGTH + 3];
+    for (uint8_t segment = 0; segment < series->num_segments; segment++) {
+        _timeseries_path(series, segment, path);
+        if (filesystem_file_exists(path)) filesystem_rm(path);
+        series->counts[segment] = 0;
+    }
+    series->oldest = 0;
+    series->used = 0;
+    series->pending = 0;
+    series->last_timestamp = 0;
+}
@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TIMESERIES_H_
+#define TIMESERIES_H_
+
+/*
+ * An append-only log of fixed-size records on the filesystem, for faces that log sensor readings or events.
+ *
+ * Each record is stored with a 32-bit timestamp. The store doesn't care what the timestamp means, only that it
+ * never goes down from one record to the next: watch_date_time.reg works, and so does a UNIX time. If the clock
+ * is set back, records appended before it catches up again get the timestamp of the newest record instead.
+ *
+ * Records go into segment files named after the series ("templog.0", "templog.1"…), each holding up to
+ * records_per_segment records. When every segment is full, the next append deletes the oldest segment, so the
+ * series keeps at least (num_segments - 1) * records_per_segment records and never takes up more than
+ * num_segments segments. Each segment file starts with a 4-byte sequence number, one higher than the segment
+ * before it, which is how the newest segment is found again after a reset: timestamps can't tell, since a run
+ * of segments can start at the same time. A segment that fits in one flash row (256 bytes) with its sequence
+ * number costs exactly one row.
+ *
+ * Appends are collected in RAM and written out a flash page (64 bytes) at a time, or when a segment fills.
+ * Until then they are readable like any other record, but they are lost if the watch resets; call
+ * timeseries_flush after an append that can't be lost.
+ *
+ * The first timestamp of each segment is kept in RAM as a sparse index, so finding a record by time takes a
+ * binary search over the segments and then one over the records in a segment.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// The most segments a series can have.
+#define TIMESERIES_MAX_SEGMENTS 8
+
+/// The size of the buffer appends are collected in before they are written out: one NVMCTRL page.
+#define TIMESERIES_BUFFER_SIZE 64
+
+/// The longest name a series can have; segment file names add a dot and the segment number.
+#define TIMESERIES_MAX_NAME_LENGTH 10
+
+/// A series of records. Treat the fields as private; use the functions below.
+typedef struct {
+    const char *name;
+    uint8_t record_size;            // bytes in a record, not counting its timestamp
+    uint8_t records_per_segment;
+    uint8_t num_segments;
+    uint8_t oldest;                 // the segment holding the oldest records
+    uint8_t used;                   // the number of segments holding records, oldest first
+    uint8_t pending;                // the number of records in buf that are not yet written out
+    uint8_t counts[TIMESERIES_MAX_SEGMENTS];            // records in each segment, including pending ones
+    uint32_t last_timestamp;                            // the timestamp of the newest record
+    uint32_t sequence;                                  // the sequence number of the newest segment
+    uint32_t first_timestamps[TIMESERIES_MAX_SEGMENTS]; // the timestamp of each segment's first record
+    uint8_t buf[TIMESERIES_BUFFER_SIZE];
+} timeseries_t;
+
+/** @brief Sets up a series and loads its index from any segments already on the filesystem.
+  * @param series the series to set up, e.g. in a face's context.
+  * @param name the name of the series, up to TIMESERIES_MAX_NAME_LENGTH characters. Must outlive the series.
+  * @param record_size the size of a record, not counting its timestamp. A record and its timestamp have to fit
+  *                    in TIMESERIES_BUFFER_SIZE.
+  * @param records_per_segment how many records a segment file holds.
+  * @param num_segments how many segment files the series can have, from 2 to TIMESERIES_MAX_SEGMENTS.
+  * @return true if the series was set up; false if the parameters are out of range.
+  * @note Changing record_size or records_per_segment for a series that is already on the filesystem makes its
+  *       old records unreadable; give the series a new name, or clear it, when you do.
+  */
+bool timeseries_init(timeseries_t *series, const char *name, uint8_t record_size, uint8_t records_per_segment, uint8_t num_segments);
+
+/** @brief Appends a record to a series, evicting the oldest segment if every segment is full.
+  * @param series the series
+  * @param timestamp the record's timestamp. If this is lower than that of the last record appended (say, the
+  *                  clock was set back), the record gets the last record's timestamp instead.
+  * @param record record_size bytes to store.
+  * @return true if the record was stored; false if it was dropped, because the buffer was full and couldn't be
+  *         written out to make room for it. A stored record can be read back right away, even if writing it
+  *         out to flash failed; that is tried again on the next append or flush, and timeseries_flush reports
+  *         whether it worked.
+  */
+bool timeseries_append(timeseries_t *series, uint32_t timestamp, const void *record);
+
+/** @brief Writes out any appended records that are still in RAM.
+  * @param series the series
+  * @return true if everything was written out; false otherwise.
+  */
+bool timeseries_flush(timeseries_t *series);
+
+/** @brief Gets the number of records in a series.
+  * @param series the series
+  */
+uint32_t timeseries_count(timeseries_t *series);
+
+/** @brief Reads consecutive records from a series.
+  * @param series the series
+  * @param index the index of the first record to read; 0 is the oldest record in the series.
+  * @param count the maximum number of records to read
+  * @param timestamps an array of at least count timestamps to fill in, or NULL if you don't need them.
+  * @param records a buffer of at least count * record_size bytes to read the records into, or NULL.
+  * @return the number of records read, which is less than count if the series ends first, or on a read error.
+  */
+uint32_t timeseries_read(timeseries_t *series, uint32_t index, uint32_t count, uint32_t *timestamps, void *records);
+
+/** @brief Finds the first record at or after a time.
+  * @param series the series
+  * @param timestamp the time to look for
+  * @return the index of the first record whose timestamp is no lower than timestamp, or timeseries_count if
+  *         there is none.
+  */
+uint32_t timeseries_find(timeseries_t *series, uint32_t timestamp);
+
+/** @brief Deletes every record in a series, including its files on the filesystem.
+  * @param series the series
+  */
+void timeseries_clear(timeseries_t *series);
+
+#endif // TIMESERIES_H_
@@ -34,7 +34,7 @@ void beats_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) watch_face_index;
     (void) context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(beats_face_state_t));
+        *context_ptr = movement_alloc_context(sizeof(beats_face_state_t));
     }
 }
 
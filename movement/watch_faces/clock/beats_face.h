@@ -42,6 +42,7 @@ typedef struct {
     int8_t next_subsecond_update;
     uint32_t last_centibeat_displayed;
 } beats_face_state_t;
+#define BEATS_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(beats_face_state_t))
 
 uint32_t clock2beats(uint32_t hours, uint32_t minutes, uint32_t seconds, uint32_t subseconds, int16_t utc_offset);
 void beats_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -42,16 +42,6 @@
 #define CLOCK_FACE_LOW_BATTERY_VOLTAGE_THRESHOLD 2200
 #endif
 
-typedef struct {
-    struct {
-        watch_date_time previous;
-    } date_time;
-    uint8_t last_battery_check;
-    uint8_t watch_face_index;
-    bool time_signal_enabled;
-    bool battery_low;
-} clock_state_t;
-
 static bool clock_is_in_24h_mode(movement_settings_t *settings) {
 #ifdef CLOCK_FACE_24H_ONLY
     return true;
@@ -221,7 +211,7 @@ void clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(clock_state_t));
+        *context_ptr = movement_alloc_context(sizeof(clock_state_t));
         clock_state_t *state = (clock_state_t *) *context_ptr;
         state->time_signal_enabled = false;
         state->watch_face_index = watch_face_index;
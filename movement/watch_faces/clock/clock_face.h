@@ -43,6 +43,17 @@
 
 #include "movement.h"
 
+typedef struct {
+    struct {
+        watch_date_time previous;
+    } date_time;
+    uint8_t last_battery_check;
+    uint8_t watch_face_index;
+    bool time_signal_enabled;
+    bool battery_low;
+} clock_state_t;
+#define CLOCK_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(clock_state_t))
+
 void clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void clock_face_activate(movement_settings_t *settings, void *context);
 bool clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
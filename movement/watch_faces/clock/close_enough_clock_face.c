@@ -66,7 +66,7 @@ void close_enough_clock_face_setup(movement_settings_t *settings, uint8_t watch_
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(close_enough_clock_state_t));
+        *context_ptr = movement_alloc_context(sizeof(close_enough_clock_state_t));
     }
 }
 
@@ -45,6 +45,7 @@ typedef struct {
     bool battery_low;
     bool alarm_enabled;
 } close_enough_clock_state_t;
+#define CLOSE_ENOUGH_CLOCK_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(close_enough_clock_state_t))
 
 void close_enough_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void close_enough_clock_face_activate(movement_settings_t *settings, void *context);
@@ -60,7 +60,7 @@ void day_night_percentage_face_setup(movement_settings_t *settings, uint8_t watc
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(day_night_percentage_state_t));
+        *context_ptr = movement_alloc_context(sizeof(day_night_percentage_state_t));
         day_night_percentage_state_t *state = (day_night_percentage_state_t *)*context_ptr;
         watch_date_time utc_now = watch_utility_date_time_convert_zone(watch_rtc_get_date_time(), movement_timezone_offsets[settings->bit.time_zone] * 60, 0);
         recalculate(utc_now, state);
@@ -48,6 +48,7 @@ typedef struct {
     double set;
     double daylen;
 } day_night_percentage_state_t;
+#define DAY_NIGHT_PERCENTAGE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(day_night_percentage_state_t))
 
 void day_night_percentage_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void day_night_percentage_face_activate(movement_settings_t *settings, void *context);
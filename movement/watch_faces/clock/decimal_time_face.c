@@ -38,7 +38,7 @@ void decimal_time_face_setup(movement_settings_t *settings, uint8_t watch_face_i
     // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
     if (*context_ptr == NULL) {
         // in this case, we allocate an area of memory sufficient to store the stuff we need to track.
-        *context_ptr = malloc(sizeof(decimal_time_face_state_t));
+        *context_ptr = movement_alloc_context(sizeof(decimal_time_face_state_t));
         decimal_time_face_state_t *state = (decimal_time_face_state_t *)*context_ptr;
         state->chime_enabled = false;
         state->features_to_show = 0 ;
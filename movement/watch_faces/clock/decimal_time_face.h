@@ -52,6 +52,7 @@ typedef struct {
     bool chime_enabled;            // did the user enable hourly chime for this face? 
     uint8_t features_to_show : 2 ; // what features are to be displayed?
 } decimal_time_face_state_t;
+#define DECIMAL_TIME_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(decimal_time_face_state_t))
 
 void decimal_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void decimal_time_face_activate(movement_settings_t *settings, void *context);
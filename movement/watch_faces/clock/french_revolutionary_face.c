@@ -30,7 +30,7 @@ void french_revolutionary_face_setup(movement_settings_t *settings, uint8_t watc
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(french_revolutionary_state_t));
+        *context_ptr = movement_alloc_context(sizeof(french_revolutionary_state_t));
         memset(*context_ptr, 0, sizeof(french_revolutionary_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
         french_revolutionary_state_t *state = (french_revolutionary_state_t *)*context_ptr;
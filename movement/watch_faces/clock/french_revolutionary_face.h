@@ -56,6 +56,7 @@ typedef struct {
     bool colon_set_after_splash;
     uint8_t display_type : 2;
 } french_revolutionary_state_t;
+#define FRENCH_REVOLUTIONARY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(french_revolutionary_state_t))
 
 typedef struct {
     uint8_t second : 8;    // 0-99
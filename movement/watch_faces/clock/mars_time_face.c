@@ -110,7 +110,7 @@ void mars_time_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(mars_time_state_t));
+        *context_ptr = movement_alloc_context(sizeof(mars_time_state_t));
         memset(*context_ptr, 0, sizeof(mars_time_state_t));
     }
 }
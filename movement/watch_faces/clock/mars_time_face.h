@@ -66,6 +66,7 @@ typedef struct {
     mars_time_site_t current_site;
     bool displaying_sol;
 } mars_time_state_t;
+#define MARS_TIME_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(mars_time_state_t))
 
 void mars_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void mars_time_face_activate(movement_settings_t *settings, void *context);
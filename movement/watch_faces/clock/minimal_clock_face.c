@@ -25,11 +25,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include "minimal_clock_face.h"
+#include "watch_utility.h"
 
 static void _minimal_clock_face_update_display(movement_settings_t *settings) {
     watch_date_time date_time = watch_rtc_get_date_time();
     char buffer[11];
 
+    // nothing changes until the top of the next minute, so we can sleep through the ticks until then.
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, 0) + 60 - date_time.unit.second;
+    movement_request_next_redraw(watch_utility_date_time_from_unix_time(timestamp, 0));
+
     if (!settings->bit.clock_mode_24h) {
         date_time.unit.hour %= 12;
         sprintf(buffer, "%2d%02d  ", date_time.unit.hour, date_time.unit.minute);
@@ -44,7 +49,7 @@ void minimal_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(minimal_clock_state_t));
+        *context_ptr = movement_alloc_context(sizeof(minimal_clock_state_t));
         memset(*context_ptr, 0, sizeof(minimal_clock_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -39,6 +39,7 @@ typedef struct {
     // Anything you need to keep track of, put it here!
     uint8_t unused;
 } minimal_clock_state_t;
+#define MINIMAL_CLOCK_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(minimal_clock_state_t))
 
 void minimal_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void minimal_clock_face_activate(movement_settings_t *settings, void *context);
@@ -71,7 +71,7 @@ void minute_repeater_decimal_face_setup(movement_settings_t *settings, uint8_t w
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(minute_repeater_decimal_state_t));
+        *context_ptr = movement_alloc_context(sizeof(minute_repeater_decimal_state_t));
         minute_repeater_decimal_state_t *state = (minute_repeater_decimal_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
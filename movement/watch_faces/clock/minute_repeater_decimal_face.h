@@ -63,6 +63,7 @@ typedef struct {
     bool battery_low;
     bool alarm_enabled;
 } minute_repeater_decimal_state_t;
+#define MINUTE_REPEATER_DECIMAL_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(minute_repeater_decimal_state_t))
 
 void mrd_play_hour_chime(void);
 void mrd_play_tens_chime(void);
@@ -56,7 +56,7 @@ void repetition_minute_face_setup(movement_settings_t *settings, uint8_t watch_f
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(repetition_minute_state_t));
+        *context_ptr = movement_alloc_context(sizeof(repetition_minute_state_t));
         repetition_minute_state_t *state = (repetition_minute_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -62,6 +62,7 @@ typedef struct {
     bool battery_low;
     bool alarm_enabled;
 } repetition_minute_state_t;
+#define REPETITION_MINUTE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(repetition_minute_state_t))
 
 void play_hour_chime(void);
 void play_quarter_chime(void);
@@ -48,7 +48,7 @@ static void _display_left_aligned(uint8_t value) {
 void simple_clock_bin_led_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_clock_bin_led_state_t));
+        *context_ptr = movement_alloc_context(sizeof(simple_clock_bin_led_state_t));
         memset(*context_ptr, 0, sizeof(simple_clock_bin_led_state_t));
         simple_clock_bin_led_state_t *state = (simple_clock_bin_led_state_t *)*context_ptr;
         state->watch_face_index = watch_face_index;
@@ -63,6 +63,7 @@ typedef struct {
     uint8_t flashing_value;
     uint8_t ticks;
 } simple_clock_bin_led_state_t;
+#define SIMPLE_CLOCK_BIN_LED_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(simple_clock_bin_led_state_t))
 
 void simple_clock_bin_led_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void simple_clock_bin_led_face_activate(movement_settings_t *settings, void *context);
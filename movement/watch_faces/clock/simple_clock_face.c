@@ -34,16 +34,57 @@ static void _update_alarm_indicator(bool settings_alarm_enabled, simple_clock_st
     else watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
 }
 
+static void _display_low_energy_time(watch_date_time date_time, movement_settings_t *settings) {
+#ifndef CLOCK_FACE_24H_ONLY
+    if (!settings->bit.clock_mode_24h) {
+        if (date_time.unit.hour < 12) {
+            watch_clear_indicator(WATCH_INDICATOR_PM);
+        } else {
+            watch_set_indicator(WATCH_INDICATOR_PM);
+        }
+        date_time.unit.hour %= 12;
+        if (date_time.unit.hour == 0) date_time.unit.hour = 12;
+    }
+#endif
+
+    bool leading_zero = settings->bit.clock_mode_24h && settings->bit.clock_24h_leading_zero;
+    watch_display_string((char *)watch_utility_get_weekday(date_time), 0);
+    watch_display_uint(date_time.unit.day, 2, 2, WATCH_DISPLAY_PAD_SPACE);
+    watch_display_uint(date_time.unit.hour, 4, 2, leading_zero ? WATCH_DISPLAY_PAD_ZERO : WATCH_DISPLAY_PAD_SPACE);
+    watch_display_uint(date_time.unit.minute, 6, 2, WATCH_DISPLAY_PAD_ZERO);
+    watch_display_string("  ", 8);
+}
+
+static void _display_low_energy_minutes(watch_date_time date_time, movement_settings_t *settings) {
+    // draw this minute and the ones after it, so Movement can have the SLCD step through them while we sleep.
+    watch_display_frame_t frames[WATCH_DISPLAY_MAX_SEQUENCE_FRAMES];
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, 0) - date_time.unit.second;
+    for (uint8_t i = 0; i < WATCH_DISPLAY_MAX_SEQUENCE_FRAMES; i++) {
+        _display_low_energy_time(watch_utility_date_time_from_unix_time(timestamp + 60 * i, 0), settings);
+        watch_display_capture_frame(&frames[i]);
+    }
+    movement_set_low_energy_frames(frames, WATCH_DISPLAY_MAX_SEQUENCE_FRAMES);
+}
+
+static void _schedule_hourly_signal(simple_clock_state_t *state) {
+    // wake for the top of the next hour.
+    watch_date_time date_time = watch_rtc_get_date_time();
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, 0);
+    timestamp += 3600 - (date_time.unit.minute * 60 + date_time.unit.second);
+    movement_schedule_background_task_for_face(state->watch_face_index, watch_utility_date_time_from_unix_time(timestamp, 0));
+}
+
 void simple_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_clock_state_t));
+        *context_ptr = movement_alloc_context(sizeof(simple_clock_state_t));
         simple_clock_state_t *state = (simple_clock_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
     }
+    // the hourly signal is scheduled for the top of the hour, so it has to be worked out again when the clock is set.
+    movement_request_time_changed_events(watch_face_index);
 }
 
 void simple_clock_face_activate(movement_settings_t *settings, void *context) {
@@ -61,6 +102,9 @@ void simple_clock_face_activate(movement_settings_t *settings, void *context) {
     if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
     else watch_clear_indicator(WATCH_INDICATOR_BELL);
 
+    // the time may have been set since we scheduled the signal.
+    if (state->signal_enabled) _schedule_hourly_signal(state);
+
     // show alarm indicator if there is an active alarm
     _update_alarm_indicator(settings->bit.alarm_enabled, state);
 
@@ -72,8 +116,6 @@ void simple_clock_face_activate(movement_settings_t *settings, void *context) {
 
 bool simple_clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     simple_clock_state_t *state = (simple_clock_state_t *)context;
-    char buf[11];
-    uint8_t pos;
 
     watch_date_time date_time;
     uint32_t previous_date_time;
@@ -99,16 +141,23 @@ bool simple_clock_face_loop(movement_event_t event, movement_settings_t *setting
             // ...and set the LAP indicator if low.
             if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
 
-            bool set_leading_zero = false;
-            if ((date_time.reg >> 6) == (previous_date_time >> 6) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
+            // handle alarm indicator
+            if (state->alarm_enabled != settings->bit.alarm_enabled) _update_alarm_indicator(settings->bit.alarm_enabled, state);
+
+            if (event.event_type == EVENT_LOW_ENERGY_UPDATE) {
+                if (!watch_tick_animation_is_running()) watch_start_tick_animation(500);
+                _display_low_energy_minutes(date_time, settings);
+                break;
+            }
+
+            if ((date_time.reg >> 6) == (previous_date_time >> 6)) {
                 // everything before seconds is the same, don't waste cycles setting those segments.
-                watch_display_character_lp_seconds('0' + date_time.unit.second / 10, 8);
-                watch_display_character_lp_seconds('0' + date_time.unit.second % 10, 9);
+                watch_display_uint(date_time.unit.second, 8, 2, WATCH_DISPLAY_PAD_ZERO);
                 break;
-            } else if ((date_time.reg >> 12) == (previous_date_time >> 12) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
+            } else if ((date_time.reg >> 12) == (previous_date_time >> 12)) {
                 // everything before minutes is the same.
-                pos = 6;
-                sprintf(buf, "%02d%02d", date_time.unit.minute, date_time.unit.second);
+                watch_display_uint(date_time.unit.minute, 6, 2, WATCH_DISPLAY_PAD_ZERO);
+                watch_display_uint(date_time.unit.second, 8, 2, WATCH_DISPLAY_PAD_ZERO);
             } else {
                 // other stuff changed; let's do it all.
 #ifndef CLOCK_FACE_24H_ONLY
@@ -124,35 +173,31 @@ bool simple_clock_face_loop(movement_event_t event, movement_settings_t *setting
                 }
 #endif
 
-                if (settings->bit.clock_mode_24h && settings->bit.clock_24h_leading_zero && date_time.unit.hour < 10) {
-                    set_leading_zero = true;
-                }
-
-                pos = 0;
-                if (event.event_type == EVENT_LOW_ENERGY_UPDATE) {
-                    if (!watch_tick_animation_is_running()) watch_start_tick_animation(500);
-                    sprintf(buf, "%s%2d%2d%02d  ", watch_utility_get_weekday(date_time), date_time.unit.day, date_time.unit.hour, date_time.unit.minute);
-                } else {
-                    sprintf(buf, "%s%2d%2d%02d%02d", watch_utility_get_weekday(date_time), date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
-                }
+                watch_display_string((char *)watch_utility_get_weekday(date_time), 0);
+                watch_display_uint(date_time.unit.day, 2, 2, WATCH_DISPLAY_PAD_SPACE);
+                watch_display_time(date_time.unit.hour, date_time.unit.minute, date_time.unit.second,
+                                   settings->bit.clock_mode_24h && settings->bit.clock_24h_leading_zero);
             }
-            watch_display_string(buf, pos);
-
-            if (set_leading_zero)
-                watch_display_string("0", 4);
-
-            // handle alarm indicator
-            if (state->alarm_enabled != settings->bit.alarm_enabled) _update_alarm_indicator(settings->bit.alarm_enabled, state);
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->signal_enabled = !state->signal_enabled;
-            if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-            else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            if (state->signal_enabled) {
+                watch_set_indicator(WATCH_INDICATOR_BELL);
+                _schedule_hourly_signal(state);
+            } else {
+                watch_clear_indicator(WATCH_INDICATOR_BELL);
+                movement_cancel_background_task_for_face(state->watch_face_index);
+            }
             break;
         case EVENT_BACKGROUND_TASK:
             // uncomment this line to snap back to the clock face when the hour signal sounds:
             // movement_move_to_face(state->watch_face_index);
-            movement_play_signal();
+            // if the clock was set since this was scheduled, it can come due at any minute; only chime on the hour.
+            if (watch_rtc_get_date_time().unit.minute == 0) movement_play_signal();
+            _schedule_hourly_signal(state);
+            break;
+        case EVENT_TIME_CHANGED:
+            if (state->signal_enabled) _schedule_hourly_signal(state);
             break;
         default:
             return movement_default_loop_handler(event, settings);
@@ -165,13 +210,3 @@ void simple_clock_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
 }
-
-bool simple_clock_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    simple_clock_state_t *state = (simple_clock_state_t *)context;
-    if (!state->signal_enabled) return false;
-
-    watch_date_time date_time = watch_rtc_get_date_time();
-
-    return date_time.unit.minute == 0;
-}
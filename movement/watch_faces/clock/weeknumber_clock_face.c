@@ -38,7 +38,7 @@ void weeknumber_clock_face_setup(movement_settings_t *settings, uint8_t watch_fa
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(weeknumber_clock_state_t));
+        *context_ptr = movement_alloc_context(sizeof(weeknumber_clock_state_t));
         weeknumber_clock_state_t *state = (weeknumber_clock_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -126,6 +126,13 @@ bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *set
                 watch_display_string("0", 4);
             // handle alarm indicator
             if (state->alarm_enabled != settings->bit.alarm_enabled) _update_alarm_indicator(settings->bit.alarm_enabled, state);
+            // we don't show seconds, so we can sleep through the ticks until the top of the next minute.
+            if (event.event_type != EVENT_LOW_ENERGY_UPDATE) {
+                // (date_time may have been converted to 12 hour time above, so start from the saved copy.)
+                date_time.reg = state->previous_date_time;
+                uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, 0) + 60 - date_time.unit.second;
+                movement_request_next_redraw(watch_utility_date_time_from_unix_time(timestamp, 0));
+            }
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->signal_enabled = !state->signal_enabled;
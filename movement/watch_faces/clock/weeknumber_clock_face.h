@@ -43,6 +43,7 @@ typedef struct {
     bool battery_low;
     bool alarm_enabled;
 } weeknumber_clock_state_t;
+#define WEEKNUMBER_CLOCK_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(weeknumber_clock_state_t))
 
 void weeknumber_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void weeknumber_clock_face_activate(movement_settings_t *settings, void *context);
@@ -127,7 +127,7 @@ void world_clock2_face_setup(movement_settings_t *settings, uint8_t watch_face_i
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(world_clock2_state_t));
+        *context_ptr = movement_alloc_context(sizeof(world_clock2_state_t));
         memset(*context_ptr, 0, sizeof(world_clock2_state_t));
 
         /* Start in settings mode */
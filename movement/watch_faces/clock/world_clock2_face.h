@@ -105,6 +105,7 @@ typedef struct {
     uint8_t current_zone;
     uint32_t previous_date_time;
 } world_clock2_state_t;
+#define WORLD_CLOCK2_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(world_clock2_state_t))
 
 void world_clock2_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void world_clock2_face_activate(movement_settings_t *settings, void *context);
@@ -27,12 +27,13 @@
 #include "world_clock_face.h"
 #include "watch.h"
 #include "watch_utility.h"
+#include "watch_private_display.h"
 
 void world_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(world_clock_state_t));
+        *context_ptr = movement_alloc_context(sizeof(world_clock_state_t));
         memset(*context_ptr, 0, sizeof(world_clock_state_t));
         uint8_t backup_register = movement_claim_backup_register();
         if (backup_register) {
@@ -52,9 +53,6 @@ void world_clock_face_activate(movement_settings_t *settings, void *context) {
 }
 
 static bool world_clock_face_do_display_mode(movement_event_t event, movement_settings_t *settings, world_clock_state_t *state) {
-    char buf[11];
-    uint8_t pos;
-
     uint32_t timestamp;
     uint32_t previous_date_time;
     watch_date_time date_time;
@@ -72,17 +70,16 @@ static bool world_clock_face_do_display_mode(movement_event_t event, movement_se
             previous_date_time = state->previous_date_time;
             state->previous_date_time = date_time.reg;
 
-            bool set_leading_zero = false;
             if ((date_time.reg >> 6) == (previous_date_time >> 6) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
                 // everything before seconds is the same, don't waste cycles setting those segments.
-                pos = 8;
-                sprintf(buf, "%02d", date_time.unit.second);
+                watch_display_uint(date_time.unit.second, 8, 2, WATCH_DISPLAY_PAD_ZERO);
             } else if ((date_time.reg >> 12) == (previous_date_time >> 12) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
                 // everything before minutes is the same.
-                pos = 6;
-                sprintf(buf, "%02d%02d", date_time.unit.minute, date_time.unit.second);
+                watch_display_uint(date_time.unit.minute, 6, 2, WATCH_DISPLAY_PAD_ZERO);
+                watch_display_uint(date_time.unit.second, 8, 2, WATCH_DISPLAY_PAD_ZERO);
             } else {
                 // other stuff changed; let's do it all.
+                bool leading_zero = false;
                 if (!settings->bit.clock_mode_24h) {
                     // if we are in 12 hour mode, do some cleanup.
                     if (date_time.unit.hour < 12) {
@@ -92,31 +89,21 @@ static bool world_clock_face_do_display_mode(movement_event_t event, movement_se
                     }
                     date_time.unit.hour %= 12;
                     if (date_time.unit.hour == 0) date_time.unit.hour = 12;
-                } else if (settings->bit.clock_24h_leading_zero && date_time.unit.hour < 10) {
-                    set_leading_zero = true;
+                } else {
+                    leading_zero = settings->bit.clock_24h_leading_zero;
                 }
-                pos = 0;
+                watch_display_character(movement_valid_position_0_chars[state->settings.bit.char_0], 0);
+                watch_display_character(movement_valid_position_1_chars[state->settings.bit.char_1], 1);
+                watch_display_uint(date_time.unit.day, 2, 2, WATCH_DISPLAY_PAD_SPACE);
                 if (event.event_type == EVENT_LOW_ENERGY_UPDATE) {
                     if (!watch_tick_animation_is_running()) watch_start_tick_animation(500);
-                    sprintf(buf, "%c%c%2d%2d%02d  ",
-                        movement_valid_position_0_chars[state->settings.bit.char_0],
-                        movement_valid_position_1_chars[state->settings.bit.char_1],
-                        date_time.unit.day,
-                        date_time.unit.hour,
-                        date_time.unit.minute);
+                    watch_display_uint(date_time.unit.hour, 4, 2, leading_zero ? WATCH_DISPLAY_PAD_ZERO : WATCH_DISPLAY_PAD_SPACE);
+                    watch_display_uint(date_time.unit.minute, 6, 2, WATCH_DISPLAY_PAD_ZERO);
+                    watch_display_string("  ", 8);
                 } else {
-                    sprintf(buf, "%c%c%2d%2d%02d%02d",
-                        movement_valid_position_0_chars[state->settings.bit.char_0],
-                        movement_valid_position_1_chars[state->settings.bit.char_1],
-                        date_time.unit.day,
-                        date_time.unit.hour,
-                        date_time.unit.minute,
-                        date_time.unit.second);
+                    watch_display_time(date_time.unit.hour, date_time.unit.minute, date_time.unit.second, leading_zero);
                 }
             }
-            watch_display_string(buf, pos);
-            if (set_leading_zero)
-                watch_display_string("0", 4);
             break;
         case EVENT_ALARM_LONG_PRESS:
             movement_request_tick_frequency(4);
@@ -63,6 +63,7 @@ typedef struct {
     uint8_t current_screen;
     uint32_t previous_date_time;
 } world_clock_state_t;
+#define WORLD_CLOCK_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(world_clock_state_t))
 
 void world_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void world_clock_face_activate(movement_settings_t *settings, void *context);
@@ -94,99 +94,81 @@ void wyoscan_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wyoscan_state_t));
+        *context_ptr = movement_alloc_context(sizeof(wyoscan_state_t));
         memset(*context_ptr, 0, sizeof(wyoscan_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
 
+// appends a step that lights or clears a segment as part of the current frame.
+static void _wyoscan_add_step(wyoscan_state_t *state, uint8_t *num_steps, uint8_t com, uint8_t seg, bool on) {
+    movement_animation_step_t *step = &state->steps[(*num_steps)++];
+    step->com = com;
+    step->seg = seg;
+    step->on = on;
+    step->keyframe = false;
+    step->ticks = 0;
+}
+
+// finds the segment that gets drawn on a given frame of the scan, if any; 'X' frames draw nothing.
+static bool _wyoscan_segment_at(const uint8_t time_digits[6], uint8_t frame, uint8_t *com, uint8_t *seg) {
+    if (frame >= 48) return false;
+    uint8_t position = frame / 8;
+    char segment = segment_map[time_digits[position]][frame % 8];
+    if (segment == 'X') return false;
+    *com = clock_mapping[position][segment - 'A'][0];
+    *seg = clock_mapping[position][segment - 'A'][1];
+    return true;
+}
+
+static void _wyoscan_play(wyoscan_state_t *state) {
+    watch_date_time date_time = watch_rtc_get_date_time();
+    uint8_t time_digits[6] = {
+        date_time.unit.hour / 10, date_time.unit.hour % 10,
+        date_time.unit.minute / 10, date_time.unit.minute % 10,
+        date_time.unit.second / 10, date_time.unit.second % 10,
+    };
+    uint8_t num_steps = 0;
+    uint8_t com, seg;
+
+    for (uint8_t frame = 0; frame < WYOSCAN_NUM_FRAMES; frame++) {
+        uint8_t first_step = num_steps;
+        // the segment at the end of the trail goes out before the next one lights up.
+        if (frame >= WYOSCAN_TRAIL_FRAMES && _wyoscan_segment_at(time_digits, frame - WYOSCAN_TRAIL_FRAMES, &com, &seg)) {
+            _wyoscan_add_step(state, &num_steps, com, seg, false);
+        }
+        // the colon blinks once a cycle, off for the first second and on for the second.
+        if (frame == 0) _wyoscan_add_step(state, &num_steps, 1, 16, false);
+        if (frame == 32) _wyoscan_add_step(state, &num_steps, 1, 16, true);
+        if (_wyoscan_segment_at(time_digits, frame, &com, &seg)) {
+            _wyoscan_add_step(state, &num_steps, com, seg, true);
+        }
+
+        // a frame that changes nothing just holds the one before it for another tick.
+        if (num_steps == first_step) state->steps[num_steps - 1].ticks++;
+        else state->steps[num_steps - 1].ticks = 1;
+    }
+
+    movement_play_animation(state->steps, num_steps, 32, false);
+}
+
 void wyoscan_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
-    wyoscan_state_t *state = (wyoscan_state_t *)context;
+    (void) context;
     movement_request_tick_frequency(32);
-    state->total_frames = 64;
 }
 
 bool wyoscan_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     wyoscan_state_t *state = (wyoscan_state_t *)context;
 
-    watch_date_time date_time;
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             break;
-        case EVENT_TICK:            
-            if (!state->animate) {
-                date_time = watch_rtc_get_date_time();
-                state->start = 0; 
-                state->end = 0;
-                state->animation = 0;
-                state->animate = true;
-                state->time_digits[0] = date_time.unit.hour / 10;
-                state->time_digits[1] = date_time.unit.hour % 10;
-                state->time_digits[2] = date_time.unit.minute / 10;
-                state->time_digits[3] = date_time.unit.minute % 10;
-                state->time_digits[4] = date_time.unit.second / 10;
-                state->time_digits[5] = date_time.unit.second % 10;
-            }
-            if ( state->animate ) {
-                // if we have reached the max number of illuminated segments, we clear the oldest one
-                if ((state->end + 1) % MAX_ILLUMINATED_SEGMENTS == state->start) {
-                    // clear the oldest pixel if it's not 'X'
-                    if (state->illuminated_segments[state->start][0] != 99 && state->illuminated_segments[state->start][1] != 99) {
-                        watch_clear_pixel(state->illuminated_segments[state->start][0], state->illuminated_segments[state->start][1]);
-                    }
-                    // increment the start index to point to the next oldest pixel
-                    state->start = (state->start + 1) % MAX_ILLUMINATED_SEGMENTS;
-                }
-                if (state->animation < state->total_frames - MAX_ILLUMINATED_SEGMENTS) {
-                    if (state->animation % 32 == 0) {
-                        if (state->colon) {
-                            watch_set_colon();
-                        } else {
-                            watch_clear_colon();
-                        }
-                        state->colon = !state->colon;
-                    }
-                    
-                    // calculate the start position for the current frame
-                    state->position = (state->animation / 8) % 6;
-                    // calculate the current segment for the current digit
-                    state->segment = state->animation % strlen(segment_map[state->time_digits[state->position]]);
-                    // get the segments for the current digit
-                    state->segments = segment_map[state->time_digits[state->position]];
-                    
-                    if (state->segments[state->segment] == 'X') {
-                        // if 'X', skip this frame
-                        state->illuminated_segments[state->end][0] = 99;
-                        state->illuminated_segments[state->end][1] = 99;
-                        state->end = (state->end + 1) % MAX_ILLUMINATED_SEGMENTS;
-                        state->animation = (state->animation + 1);
-                        break;
-                    }
-
-                    // calculate the animation frame
-                    state->x = clock_mapping[state->position][state->segments[state->segment]-'A'][0];
-                    state->y = clock_mapping[state->position][state->segments[state->segment]-'A'][1];
-                    
-                    // set the new pixel
-                    watch_set_pixel(state->x, state->y);
-                    
-                    // store this pixel in the buffer
-                    state->illuminated_segments[state->end][0] = state->x;
-                    state->illuminated_segments[state->end][1] = state->y;
-                    // increment the end index to the next position
-                    state->end = (state->end + 1) % MAX_ILLUMINATED_SEGMENTS;
-                } 
-                else if (state->animation >= state->total_frames - MAX_ILLUMINATED_SEGMENTS && state->animation < state->total_frames) {
-                    state->end = (state->end + 1) % MAX_ILLUMINATED_SEGMENTS;
-                }
-                else {
-                    // reset the animation state
-                    state->animate = false;
-                }
-                state->animation = (state->animation + 1);
-            } 
+        case EVENT_TICK:
+        case EVENT_ANIMATION_DONE:
+            // while a cycle plays, ticks go to the animation; each new cycle scans out the time as it is then.
+            _wyoscan_play(state);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             break;
@@ -38,8 +38,8 @@
  * 8 frames per number * 6 numbers + the trailing 16 frames = 64 frames
  * at 32 frames per second, this is a 2-second cycle time or 0.5 Hz.
  *
- * It is giving me a stack overflow after about 2.5 cycles of the time display
- * in the emulator, but it works fine on the watch.
+ * Each cycle is worked out in one go when it starts, and Movement plays it
+ * from the tick interrupt, so the face only runs once every two seconds.
  *
  * I'd like to make something for the low energy mode, but I haven't thought
  * about how that might work, right now it just freezes in low energy mode
@@ -51,27 +51,17 @@
 
 #include "movement.h"
 
-#define MAX_ILLUMINATED_SEGMENTS 16
+// 8 frames for each of the six digits, plus 17 more for the trail to fade out.
+#define WYOSCAN_NUM_FRAMES 65
+// each segment stays lit this many frames, leaving a trail behind the one being drawn.
+#define WYOSCAN_TRAIL_FRAMES 15
+// at most seven segments a digit, each lit once and cleared once, plus turning the colon off and on.
+#define WYOSCAN_MAX_STEPS (6 * 7 * 2 + 2)
 
 typedef struct {
-    uint32_t previous_date_time;
-    uint8_t last_battery_check;
-    uint8_t watch_face_index;
-    bool signal_enabled;
-    bool battery_low;
-    bool alarm_enabled;
-    uint8_t animation;
-    bool animate;
-    uint32_t start;
-    uint32_t end;
-    uint32_t total_frames;
-    bool colon;
-    uint8_t position, segment;
-    char *segments;
-    uint8_t x, y;
-    uint32_t time_digits[6];
-    uint32_t illuminated_segments[MAX_ILLUMINATED_SEGMENTS][2]; 
+    movement_animation_step_t steps[WYOSCAN_MAX_STEPS];
 } wyoscan_state_t;
+#define WYOSCAN_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(wyoscan_state_t))
 
 void wyoscan_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void wyoscan_face_activate(movement_settings_t *settings, void *context);
@@ -33,6 +33,7 @@
 #include "chirpy_tx.h"
 #include "watch.h"
 #include "watch_utility.h"
+#include "timeseries.h"
 
 // ===========================================================================
 // This part is configurable: you can edit values here to customize you activity face
@@ -72,11 +73,8 @@ static const uint8_t num_enabled_activities = sizeof(enabled_activities) / sizeo
 // End configurable section
 // ===========================================================================
 
-// One logged activity
+// One logged activity. Its start time is the record's timestamp in the log.
 typedef struct __attribute__((__packed__)) {
-    // Activity's start time
-    watch_date_time start_time;
-
     // Total duration of activity, including time spend in paus
     uint16_t total_sec;
 
@@ -90,69 +88,21 @@ typedef struct __attribute__((__packed__)) {
 
 #define MAX_ACTIVITY_SECONDS 28800 // 8 hours = 28800 sec
 
-// Size of (fixed) buffer to log activites. Takes up x9 bytes in SRAM if face is installed.
+// Maximum number of activities in the log.
 #define ACTIVITY_LOG_SZ 99
 
-// Number of activities in buffer.
-static uint8_t activity_log_count = 0;
+// The log is kept in files of 28 activities (256 bytes with the file's header, exactly one flash row); four of them
+// can hold more than ACTIVITY_LOG_SZ, so the log never has to drop old activities to make room.
+#define ACTIVITY_LOG_ITEMS_PER_FILE 28
+#define ACTIVITY_LOG_NUM_FILES 4
 
-// Buffer with all logged activities.
-static activity_item_t activity_log_buffer[ACTIVITY_LOG_SZ];
+// All logged activities, timestamped with their start time.
+static timeseries_t activity_log;
 
 #define CHIRPY_PREFIX_LEN 2
 // First two bytes chirped out, to identify transmission as from the activity face
 static const uint8_t activity_chirpy_prefix[CHIRPY_PREFIX_LEN] = {0x27, 0x00};
 
-// The face's different UI modes (views).
-typedef enum {
-    ACTM_CHOOSE = 0,
-    ACTM_LOGGING,
-    ACTM_PAUSED,
-    ACTM_DONE,
-    ACTM_LOGSIZE,
-    ACTM_CHIRP,
-    ACTM_CHIRPING,
-    ACTM_CLEAR,
-    ACTM_CLEAR_CONFIRM,
-    ACTM_CLEAR_DONE,
-} activity_mode_t;
-
-// The full state of the activity face
-typedef struct {
-    // Current mode (which secondary face, or ongoing operation like logging)
-    activity_mode_t mode;
-
-    // Index of currently selected activity in enabled_activities
-    uint8_t type_ix;
-
-    // Used for different things depending on mode
-    // In ACTM_DONE: countdown for animation, before returning to start face
-    // In ACTM_LOGGING and ACTM_PAUSED: drives blinking colon and alternating time display
-    // In ACTM_LOGSIZE, ACTM_CLEAR: enables timeout return to choose screen
-    uint16_t counter;
-
-    // Start of currently logged activity, if any
-    watch_date_time start_time;
-
-    // Total seconds elapsed since logging started
-    uint16_t curr_total_sec;
-
-    // Total paused seconds in current log
-    uint16_t curr_pause_sec;
-
-    // Helps us handle 1/64 ticks during transmission; including countdown timer
-    chirpy_tick_state_t chirpy_tick_state;
-
-    // Used by chirpy encoder during transmission
-    chirpy_encoder_state_t chirpy_encoder_state;
-
-    // 0: Running normally
-    // 1: In LE mode
-    // 2: Just woke up from LE mode. Will go to 0 after ignoring ALARM_BUTTON_UP.
-    uint8_t le_state;
-
-} activity_state_t;
-
 #define ACTIVITY_BUF_SZ 14
 
 // Temp buffer used for sprintf'ing content for the display.
@@ -162,8 +112,6 @@ char activity_buf[ACTIVITY_BUF_SZ];
 uint16_t *activity_seq_pos;
 
 static void _activity_clear_buffers() {
-    // Clear activity buffer; 0xcd is good for diagnostics
-    memset(activity_log_buffer, 0xcd, ACTIVITY_LOG_SZ * sizeof(activity_item_t));
     // Clear display buffer
     memset(activity_buf, 0, ACTIVITY_BUF_SZ);
 }
@@ -176,10 +124,11 @@ void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index
     (void)settings;
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(activity_state_t));
+        *context_ptr = movement_alloc_context(sizeof(activity_state_t));
         memset(*context_ptr, 0, sizeof(activity_state_t));
         // This happens only at boot
         _activity_clear_buffers();
+        timeseries_init(&activity_log, "activity", sizeof(activity_item_t), ACTIVITY_LOG_ITEMS_PER_FILE, ACTIVITY_LOG_NUM_FILES);
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
@@ -218,7 +167,7 @@ static void _activity_activate(movement_settings_t *settings, activity_state_t *
 static void _activity_display_choice(activity_state_t *state) {
     watch_display_string("AC", 0);
     // If buffer is full: We say "FULL"
-    if (activity_log_count >= ACTIVITY_LOG_SZ) {
+    if (timeseries_count(&activity_log) >= ACTIVITY_LOG_SZ) {
         watch_display_string(" FULL ", 4);
     }
     // Otherwise, we show currently activity
@@ -372,7 +321,12 @@ static void _activity_chirp_tick_countdown(void *context) {
 }
 
 static uint8_t _activity_get_next_byte(uint8_t *next_byte) {
-    uint16_t num_bytes = 2 + activity_log_count * sizeof(activity_item_t);
+    // The item being transmitted, read from the log as its first byte goes out
+    static watch_date_time start_time;
+    static activity_item_t item;
+    const activity_item_t *itm = &item;
+    uint8_t activity_log_count = timeseries_count(&activity_log);
+    uint16_t num_bytes = 2 + activity_log_count * (sizeof(watch_date_time) + sizeof(activity_item_t));
     uint16_t pos = *activity_seq_pos;
 
     // Init counter
@@ -391,14 +345,14 @@ static uint8_t _activity_get_next_byte(uint8_t *next_byte) {
     // Data
     else {
         pos -= 2;
-        uint16_t ix = pos / sizeof(activity_item_t);
-        const activity_item_t *itm = &activity_log_buffer[ix];
-        uint16_t ofs = pos % sizeof(activity_item_t);
+        uint16_t ix = pos / (sizeof(watch_date_time) + sizeof(activity_item_t));
+        uint16_t ofs = pos % (sizeof(watch_date_time) + sizeof(activity_item_t));
 
-        // Update counter when starting new item
+        // Update counter and fetch the item when starting new item
         if (ofs == 0) {
             sprintf(activity_buf, "%3d", activity_log_count - ix);
             watch_display_string(activity_buf, 5);
+            if (timeseries_read(&activity_log, ix, 1, &start_time.reg, &item) != 1) return 0;
         }
 
         // Do this the hard way, byte by byte, to avoid high/low endedness issues
@@ -409,13 +363,13 @@ static uint8_t _activity_get_next_byte(uint8_t *next_byte) {
         // uint16_t pause_sec;
         // uint8_t activity_type;
         if (ofs == 0)
-            val = (itm->start_time.reg & 0xff000000) >> 24;
+            val = (start_time.reg & 0xff000000) >> 24;
         else if (ofs == 1)
-            val = (itm->start_time.reg & 0x00ff0000) >> 16;
+            val = (start_time.reg & 0x00ff0000) >> 16;
         else if (ofs == 2)
-            val = (itm->start_time.reg & 0x0000ff00) >> 8;
+            val = (start_time.reg & 0x0000ff00) >> 8;
         else if (ofs == 3)
-            val = (itm->start_time.reg & 0x000000ff);
+            val = (start_time.reg & 0x000000ff);
         else if (ofs == 4)
             val = (itm->total_sec & 0xff00) >> 8;
         else if (ofs == 5)
@@ -436,13 +390,14 @@ static void _activity_finish_logging(activity_state_t *state) {
     // Save this activity
     // If shorter than minimum for log: don't save
     // Sanity check about buffer length. This should never happen, but also we never want to overrun by error
-    if (state->curr_total_sec >= activity_min_length_sec && activity_log_count + 1 < ACTIVITY_LOG_SZ) {
-        activity_item_t *itm = &activity_log_buffer[activity_log_count];
-        itm->start_time = state->start_time;
-        itm->total_sec = state->curr_total_sec;
-        itm->pause_sec = state->curr_pause_sec;
-        itm->activity_type = state->type_ix;
-        ++activity_log_count;
+    if (state->curr_total_sec >= activity_min_length_sec && timeseries_count(&activity_log) + 1 < ACTIVITY_LOG_SZ) {
+        activity_item_t itm;
+        itm.total_sec = state->curr_total_sec;
+        itm.pause_sec = state->curr_pause_sec;
+        itm.activity_type = state->type_ix;
+        // Write it out right away; an activity is too much to lose to a reset
+        timeseries_append(&activity_log, state->start_time.reg, &itm);
+        timeseries_flush(&activity_log);
     }
 
     // Go to DONE animation
@@ -545,7 +500,7 @@ static void _activity_alarm_long(movement_settings_t *settings, activity_state_t
     // On choose face: start logging activity
     if (state->mode == ACTM_CHOOSE) {
         // If buffer is full: Ignore this long press
-        if (activity_log_count >= ACTIVITY_LOG_SZ)
+        if (timeseries_count(&activity_log) >= ACTIVITY_LOG_SZ)
             return;
         // OK, we go ahead and start logging
         state->start_time = watch_rtc_get_date_time();
@@ -577,7 +532,7 @@ static void _activity_alarm_long(movement_settings_t *settings, activity_state_t
     }
     // If clear: confirm (unless empty)
     else if (state->mode == ACTM_CLEAR) {
-        if (activity_log_count == 0)
+        if (timeseries_count(&activity_log) == 0)
             return;
         state->mode = ACTM_CLEAR_CONFIRM;
         state->counter = -1;
@@ -586,7 +541,7 @@ static void _activity_alarm_long(movement_settings_t *settings, activity_state_t
     // If clear confirm: do clear.
     else if (state->mode == ACTM_CLEAR_CONFIRM) {
         _activity_clear_buffers();
-        activity_log_count = 0;
+        timeseries_clear(&activity_log);
         state->mode = ACTM_CLEAR_DONE;
         state->counter = -1;
         watch_display_string("0     ", 4);
@@ -626,7 +581,7 @@ static void _activity_light_short(activity_state_t *state) {
     if (state->mode == ACTM_CHOOSE) {
         state->mode = ACTM_LOGSIZE;
         state->counter = 0;
-        sprintf(activity_buf, "AC  L#g%3d", activity_log_count);
+        sprintf(activity_buf, "AC  L#g%3d", (int)timeseries_count(&activity_log));
         watch_display_string(activity_buf, 0);
     }
     // If log size face: move to chirp
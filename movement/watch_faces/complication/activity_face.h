@@ -33,7 +33,8 @@
  * it stores when it started and how long it was.
  * 
  * You can save up to 99 activities this way. Every once in a while you can chirp them out
- * using the watch's piezo buzzer as a modem, then clear the log in the watch.
+ * using the watch's piezo buzzer as a modem, then clear the log in the watch. The log is kept
+ * on the filesystem, in "activity.0" through "activity.3", so it survives a reset.
  * To record and decode a chirpy transmission on your computer, you can use the web app here:
  * https://jealousmarkup.xyz/off/chirpy/rx/
  * 
@@ -70,6 +71,58 @@
  */
 
 #include "movement.h"
+#include "chirpy_tx.h"
+
+// The face's different UI modes (views).
+typedef enum {
+    ACTM_CHOOSE = 0,
+    ACTM_LOGGING,
+    ACTM_PAUSED,
+    ACTM_DONE,
+    ACTM_LOGSIZE,
+    ACTM_CHIRP,
+    ACTM_CHIRPING,
+    ACTM_CLEAR,
+    ACTM_CLEAR_CONFIRM,
+    ACTM_CLEAR_DONE,
+} activity_mode_t;
+
+// The full state of the activity face
+typedef struct {
+    // Current mode (which secondary face, or ongoing operation like logging)
+    activity_mode_t mode;
+
+    // Index of currently selected activity in enabled_activities
+    uint8_t type_ix;
+
+    // Used for different things depending on mode
+    // In ACTM_DONE: countdown for animation, before returning to start face
+    // In ACTM_LOGGING and ACTM_PAUSED: drives blinking colon and alternating time display
+    // In ACTM_LOGSIZE, ACTM_CLEAR: enables timeout return to choose screen
+    uint16_t counter;
+
+    // Start of currently logged activity, if any
+    watch_date_time start_time;
+
+    // Total seconds elapsed since logging started
+    uint16_t curr_total_sec;
+
+    // Total paused seconds in current log
+    uint16_t curr_pause_sec;
+
+    // Helps us handle 1/64 ticks during transmission; including countdown timer
+    chirpy_tick_state_t chirpy_tick_state;
+
+    // Used by chirpy encoder during transmission
+    chirpy_encoder_state_t chirpy_encoder_state;
+
+    // 0: Running normally
+    // 1: In LE mode
+    // 2: Just woke up from LE mode. Will go to 0 after ignoring ALARM_BUTTON_UP.
+    uint8_t le_state;
+
+} activity_state_t;
+#define ACTIVITY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(activity_state_t))
 
 void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void activity_face_activate(movement_settings_t *settings, void *context);
@@ -211,7 +211,7 @@ void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_state_t));
+        *context_ptr = movement_alloc_context(sizeof(alarm_state_t));
         alarm_state_t *state = (alarm_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(alarm_state_t));
         // initialize the default alarm values
@@ -291,6 +291,7 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
                     // revert change of enabled flag and show it briefly
                     state->alarm[state->alarm_idx].enabled ^= 1;
                     _alarm_set_signal(state);
+                    watch_display_commit();
                     delay_ms(275);
                     state->alarm_idx = 0;
                 }
@@ -83,6 +83,7 @@ typedef struct {
     bool is_setting : 1;
     alarm_setting_t alarm[ALARM_ALARMS];
 } alarm_state_t;
+#define ALARM_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(alarm_state_t))
 
 
 void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -192,7 +192,7 @@ void astronomy_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(astronomy_state_t));
+        *context_ptr = movement_alloc_context(sizeof(astronomy_state_t));
         memset(*context_ptr, 0, sizeof(astronomy_state_t));
     }
 }
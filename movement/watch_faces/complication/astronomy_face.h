@@ -92,6 +92,7 @@ typedef struct {
     double azimuth;     // in decimal degrees
     double distance;    // in AU
 } astronomy_state_t;
+#define ASTRONOMY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(astronomy_state_t))
 
 void astronomy_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void astronomy_face_activate(movement_settings_t *settings, void *context);
@@ -58,6 +58,7 @@ typedef struct {
     bool fast;
     uint8_t color;
 } blinky_face_state_t;
+#define BLINKY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(blinky_face_state_t))
 
 void blinky_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void blinky_face_activate(movement_settings_t *settings, void *context);
@@ -27,10 +27,15 @@
 #include "breathing_face.h"
 #include "watch.h"
 
-typedef struct {
-    uint8_t current_stage;
-    bool sound_on;
-} breathing_state_t;
+// the sixteen stages come to 110 segment changes, with a little room to spare.
+#define BREATHING_MAX_STEPS 112
+
+static const char *breathing_stages[] = {
+    "Breath", "In   3", "In   2", "In   1",
+    "Hold 4", "Hold 3", "Hold 2", "Hold 1",
+    "Ou t 4", "Ou t 3", "Ou t 2", "Ou t 1",
+    "Hold 4", "Hold 3", "Hold 2", "Hold 1",
+};
 
 static void beep_in (void);
 static void beep_in_hold (void);
@@ -45,7 +50,30 @@ void breathing_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
     if (*context_ptr == NULL) {
         // in this case, we allocate an area of memory sufficient to store the stuff we need to track.
-        *context_ptr = malloc(sizeof(breathing_state_t));
+        *context_ptr = movement_alloc_context(sizeof(breathing_state_t));
+        memset(*context_ptr, 0, sizeof(breathing_state_t));
+    }
+}
+
+// draws every stage in turn and works out what changes from one to the next, starting from the last stage.
+static void _breathing_build_animation(breathing_state_t *state) {
+    watch_display_frame_t previous, frame;
+    watch_display_string((char *)breathing_stages[15], 4);
+    watch_display_capture_frame(&previous);
+
+    state->num_steps = 0;
+    for (uint8_t stage = 0; stage < 16; stage++) {
+        watch_display_string((char *)breathing_stages[stage], 4);
+        watch_display_capture_frame(&frame);
+        // every fourth stage starts a side of the box, and a new set of beeps.
+        uint16_t num_steps = movement_animation_add_frame(&previous, &frame, &state->steps[state->num_steps],
+                                                          BREATHING_MAX_STEPS - state->num_steps, 1, stage % 4 == 0);
+        if (num_steps == 0) {
+            state->steps = NULL;
+            return;
+        }
+        state->num_steps += num_steps;
+        previous = frame;
     }
 }
 
@@ -57,6 +85,11 @@ void breathing_face_activate(movement_settings_t *settings, void *context) {
     // ...and set the initial state of our watch face.
     state->current_stage = 0;
     state->sound_on = true;
+    // coming back from low energy mode, we still have the animation from last time.
+    if (state->steps == NULL) {
+        state->steps = movement_alloc_scratch(BREATHING_MAX_STEPS * sizeof(movement_animation_step_t));
+        if (state->steps != NULL) _breathing_build_animation(state);
+    }
 }
 
 const int NOTE_LENGTH = 80;
@@ -125,56 +158,59 @@ void beep_out_hold (void) {
         }
 }
 
+// plays the beeps for one side of the box: breathing in, holding, breathing out or holding again.
+static void _breathing_beep(breathing_state_t *state, uint8_t side) {
+    if (!state->sound_on) return;
+    switch (side) {
+        case 0: beep_in(); break;
+        case 1: beep_in_hold(); break;
+        case 2: beep_out(); break;
+        case 3: beep_out_hold(); break;
+    }
+}
+
 bool breathing_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
     breathing_state_t *state = (breathing_state_t *)context;
 
     switch (event.event_type) {
         case EVENT_ACTIVATE:
-        case EVENT_TICK:
-
             if (state->sound_on == true) {
                 watch_set_indicator(WATCH_INDICATOR_BELL); 
             } else {
                 watch_clear_indicator(WATCH_INDICATOR_BELL); 
             }
-
-            switch (state->current_stage)
-            {
-            case 0: { watch_display_string("Breath", 4); if (state->sound_on) beep_in(); } break;
-            case 1: watch_display_string("In   3", 4); break;
-            case 2: watch_display_string("In   2", 4); break;
-            case 3: watch_display_string("In   1", 4); break;
-            
-            case 4: { watch_display_string("Hold 4", 4); if (state->sound_on) beep_in_hold(); } break;
-            case 5: watch_display_string("Hold 3", 4); break;
-            case 6: watch_display_string("Hold 2", 4); break;               
-            case 7:  watch_display_string("Hold 1", 4); break;
-
-            case 8: { watch_display_string("Ou t 4", 4); if (state->sound_on) beep_out(); } break;
-            case 9: watch_display_string("Ou t 3", 4); break;
-            case 10: watch_display_string("Ou t 2", 4); break;
-            case 11: watch_display_string("Ou t 1", 4); break;         
-            
-            case 12: { watch_display_string("Hold 4", 4); if (state->sound_on) beep_out_hold(); } break;
-            case 13: watch_display_string("Hold 3", 4); break;
-            case 14: watch_display_string("Hold 2", 4); break;     
-            case 15: watch_display_string("Hold 1", 4); break;     
-            default:
+            if (state->steps != NULL) {
+                // from here on, Movement steps through the stages itself, and only calls us to beep.
+                // the first frame is the change from the last stage to the first, so that's where it has to start.
+                watch_display_string((char *)breathing_stages[15], 4);
+                movement_play_animation(state->steps, state->num_steps, 1, true);
+                _breathing_beep(state, 0);
                 break;
             }
+            // if there was no room for the animation, we draw each stage ourselves, once a second.
+            // fall through
+        case EVENT_TICK:
+            watch_display_string((char *)breathing_stages[state->current_stage], 4);
+            if (state->current_stage % 4 == 0) _breathing_beep(state, state->current_stage / 4);
 
             // and increment it so that it will update on the next tick.
             state->current_stage = (state->current_stage + 1) % 16;
 
+            break;
+        case EVENT_ANIMATION_KEYFRAME:
+            _breathing_beep(state, movement_get_animation_keyframe() % 4);
             break;
         case EVENT_ALARM_BUTTON_UP:
             state->sound_on = !state->sound_on;            
+            // the display belongs to the animation, so it has to stop while we draw the bell.
+            movement_stop_animation();
              if (state->sound_on == true) {
                 watch_set_indicator(WATCH_INDICATOR_BELL); 
             } else {
                 watch_clear_indicator(WATCH_INDICATOR_BELL); 
             }
+            movement_resume_animation();
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             // This low energy mode update occurs once a minute, if the watch face is in the
@@ -201,8 +237,8 @@ bool breathing_face_loop(movement_event_t event, movement_settings_t *settings,
 }
 
 void breathing_face_resign(movement_settings_t *settings, void *context) {
-    // our watch face, like most watch faces, has nothing special to do when resigning.
-    // watch faces that enable a peripheral or interact with a sensor may want to turn it off here.
     (void) settings;
-    (void) context;
+    breathing_state_t *state = (breathing_state_t *)context;
+    // the animation lived in scratch memory, which Movement takes back now.
+    state->steps = NULL;
 }
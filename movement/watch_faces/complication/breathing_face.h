@@ -38,6 +38,15 @@
 
 #include "movement.h"
 
+typedef struct {
+    uint8_t current_stage;
+    bool sound_on;
+    // the whole cycle, worked out when the face comes up. NULL if there wasn't room for it.
+    movement_animation_step_t *steps;
+    uint16_t num_steps;
+} breathing_state_t;
+#define BREATHING_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(breathing_state_t))
+
 void breathing_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void breathing_face_activate(movement_settings_t *settings, void *context);
 bool breathing_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
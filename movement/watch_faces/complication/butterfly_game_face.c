@@ -421,7 +421,7 @@ void butterfly_game_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(butterfly_game_state_t));
+        *context_ptr = movement_alloc_context(sizeof(butterfly_game_state_t));
         memset(*context_ptr, 0, sizeof(butterfly_game_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -107,6 +107,7 @@ typedef struct {
     uint8_t score_p1 : 5;
     uint8_t score_p2 : 5;
 } butterfly_game_state_t;
+#define BUTTERFLY_GAME_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(butterfly_game_state_t))
 
 void butterfly_game_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void butterfly_game_face_activate(movement_settings_t *settings, void *context);
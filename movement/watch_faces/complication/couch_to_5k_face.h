@@ -69,6 +69,7 @@ typedef struct {
     exercise_type_t exercise_type;
     uint16_t timer;
 } couch_to_5k_state_t;
+#define COUCH_TO_5K_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(couch_to_5k_state_t))
 
 void couch_to_5k_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void couch_to_5k_face_activate(movement_settings_t *settings, void *context);
@@ -188,7 +188,7 @@ void countdown_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(countdown_state_t));
+        *context_ptr = movement_alloc_context(sizeof(countdown_state_t));
         countdown_state_t *state = (countdown_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(countdown_state_t));
         state->minutes = DEFAULT_MINUTES;
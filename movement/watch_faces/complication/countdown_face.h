@@ -65,6 +65,7 @@ typedef struct {
     bool repeat;
     uint8_t watch_face_index;
 } countdown_state_t;
+#define COUNTDOWN_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(countdown_state_t))
 
 
 void countdown_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
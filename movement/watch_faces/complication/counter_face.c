@@ -31,7 +31,7 @@ void counter_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(counter_state_t));
+        *context_ptr = movement_alloc_context(sizeof(counter_state_t));
         memset(*context_ptr, 0, sizeof(counter_state_t));
         counter_state_t *state = (counter_state_t *)*context_ptr;
         state->beep_on = true;
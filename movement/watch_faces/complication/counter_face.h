@@ -42,6 +42,7 @@ typedef struct {
     uint8_t counter_idx;
     bool beep_on;
 } counter_state_t;
+#define COUNTER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(counter_state_t))
 
 
 void counter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
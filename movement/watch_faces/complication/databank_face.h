@@ -57,4 +57,6 @@ void databank_face_resign(movement_settings_t *settings, void *context);
     NULL, \
 })
 
+#define DATABANK_FACE_CONTEXT_SIZE 0
+
 #endif // DATABANK_FACE_H_
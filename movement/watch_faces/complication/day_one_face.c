@@ -77,7 +77,7 @@ void day_one_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(day_one_state_t));
+        *context_ptr = movement_alloc_context(sizeof(day_one_state_t));
         memset(*context_ptr, 0, sizeof(day_one_state_t));
         movement_birthdate_t movement_birthdate = (movement_birthdate_t) watch_get_backup_data(2);
         if (movement_birthdate.reg == 0) {
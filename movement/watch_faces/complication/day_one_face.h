@@ -66,6 +66,7 @@ typedef struct {
     bool quick_cycle;
     uint8_t ticks;
 } day_one_state_t;
+#define DAY_ONE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(day_one_state_t))
 
 void day_one_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void day_one_face_activate(movement_settings_t *settings, void *context);
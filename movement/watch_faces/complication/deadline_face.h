@@ -47,6 +47,7 @@ typedef struct {
     uint8_t face_idx;
     uint32_t deadlines[DEADLINE_FACE_DATES];
 } deadline_state_t;
+#define DEADLINE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(deadline_state_t))
 
 void deadline_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void deadline_face_activate(movement_settings_t *settings, void *context);
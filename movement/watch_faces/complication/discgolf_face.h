@@ -77,6 +77,7 @@ typedef struct {
     int scores[18];             // Scores for each played hole
     discgolf_mode_t mode;       // Watch face mode
 } discgolf_state_t;
+#define DISCGOLF_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(discgolf_state_t))
 
 void discgolf_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void discgolf_face_activate(movement_settings_t *settings, void *context);
@@ -230,7 +230,7 @@ void dual_timer_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(dual_timer_state_t));
+        *context_ptr = movement_alloc_context(sizeof(dual_timer_state_t));
         memset(*context_ptr, 0, sizeof(dual_timer_state_t));
         _ticks = 0;
     }
@@ -84,6 +84,7 @@ typedef struct {
     bool running[2];
     bool show;
 } dual_timer_state_t;
+#define DUAL_TIMER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(dual_timer_state_t))
 
 void dual_timer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void dual_timer_face_activate(movement_settings_t *settings, void *context);
@@ -382,6 +382,7 @@ static void display_lose_screen(endless_runner_state_t *state) {
     game_state.curr_screen = SCREEN_LOSE;
     game_state.curr_score = 0;
     watch_display_string("     LOSE ", 0);
+    watch_display_commit();
     if (state -> soundOn)
         watch_buzzer_play_note(BUZZER_NOTE_A1, 600);
     else
@@ -532,6 +533,7 @@ static void update_game(endless_runner_state_t *state, uint8_t subsecond) {
         break;
     }
     if (game_state.jump_state == NOT_JUMPING && (game_state.loc_2_on || game_state.loc_3_on)) {
+        watch_display_commit();
         delay_ms(200);  // To show the player jumping onto the obstacle before displaying the lose screen.
         display_lose_screen(state);
     }
@@ -543,7 +545,7 @@ void endless_runner_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(endless_runner_state_t));
+        *context_ptr = movement_alloc_context(sizeof(endless_runner_state_t));
         memset(*context_ptr, 0, sizeof(endless_runner_state_t));
         endless_runner_state_t *state = (endless_runner_state_t *)*context_ptr;
         state->difficulty = DIFF_NORM;
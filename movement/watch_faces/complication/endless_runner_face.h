@@ -44,6 +44,7 @@ typedef struct {
     uint8_t soundOn : 1;
     /* 24 bits, likely aligned to 32 bits = 4 bytes */
 } endless_runner_state_t;
+#define ENDLESS_RUNNER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(endless_runner_state_t))
 
 void endless_runner_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void endless_runner_face_activate(movement_settings_t *settings, void *context);
@@ -41,6 +41,7 @@ typedef struct {
     // Anything you need to keep track of, put it here!
     uint8_t unused;
 } flashlight_state_t;
+#define FLASHLIGHT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(flashlight_state_t))
 
 void flashlight_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void flashlight_face_activate(movement_settings_t *settings, void *context);
@@ -81,6 +81,7 @@ typedef struct {
     uint8_t animation;
     bool animate;
 } geomancy_state_t;
+#define GEOMANCY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(geomancy_state_t))
 
 void geomancy_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void geomancy_face_activate(movement_settings_t *settings, void *context);
@@ -41,19 +41,12 @@ static inline uint32_t days_since_unix(const uint32_t since,
   return (until - since) / (60 * 60 * 24);
 }
 
-typedef struct {
-  uint16_t total_count;
-  uint8_t lookback;
-  uint32_t last_update;
-  bool display_total;
-} habit_state_t;
-
 void habit_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
                       void **context_ptr) {
   (void)settings;
   (void)watch_face_index;
   if (*context_ptr == NULL) {
-    *context_ptr = malloc(sizeof(habit_state_t));
+    *context_ptr = movement_alloc_context(sizeof(habit_state_t));
     memset(*context_ptr, 0, sizeof(habit_state_t));
     habit_state_t *state = (habit_state_t *)*context_ptr;
     state->lookback = 0;
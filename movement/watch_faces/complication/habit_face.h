@@ -36,6 +36,14 @@
 
 #include "movement.h"
 
+typedef struct {
+  uint16_t total_count;
+  uint8_t lookback;
+  uint32_t last_update;
+  bool display_total;
+} habit_state_t;
+#define HABIT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(habit_state_t))
+
 void habit_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
                       void **context_ptr);
 void habit_face_activate(movement_settings_t *settings, void *context);
@@ -332,7 +332,7 @@ void higher_lower_game_face_setup(movement_settings_t *settings, uint8_t watch_f
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(higher_lower_game_face_state_t));
+        *context_ptr = movement_alloc_context(sizeof(higher_lower_game_face_state_t));
         memset(*context_ptr, 0, sizeof(higher_lower_game_face_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
         memset(game_board, 0, sizeof(game_board));
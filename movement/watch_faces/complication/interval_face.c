@@ -373,7 +373,7 @@ void interval_face_setup(movement_settings_t *settings, uint8_t watch_face_index
     (void) settings;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(interval_face_state_t));
+        *context_ptr = movement_alloc_context(sizeof(interval_face_state_t));
         interval_face_state_t *state = (interval_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(interval_face_state_t));
         state->face_idx = watch_face_index;
@@ -110,6 +110,7 @@ typedef struct {
     interval_timer_state_t face_state;
     interval_timer_setting_t timer[INTERVAL_TIMERS];
 } interval_face_state_t;
+#define INTERVAL_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(interval_face_state_t))
 
 void interval_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void interval_face_activate(movement_settings_t *settings, void *context);
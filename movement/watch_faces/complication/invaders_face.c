@@ -207,7 +207,7 @@ void invaders_face_setup(movement_settings_t *settings, uint8_t watch_face_index
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(invaders_state_t));
+        *context_ptr = movement_alloc_context(sizeof(invaders_state_t));
         memset(*context_ptr, 0, sizeof(invaders_state_t));
         invaders_state_t *state = (invaders_state_t *)*context_ptr;
         // default: sound on
@@ -64,6 +64,7 @@ typedef struct {
     uint16_t highscore;
     bool sound_on;
 } invaders_state_t;
+#define INVADERS_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(invaders_state_t))
 
 void invaders_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void invaders_face_activate(movement_settings_t *settings, void *context);
@@ -98,7 +98,7 @@ void kitchen_conversions_face_setup(movement_settings_t *settings, uint8_t watch
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(kitchen_conversions_state_t));
+        *context_ptr = movement_alloc_context(sizeof(kitchen_conversions_state_t));
         memset(*context_ptr, 0, sizeof(kitchen_conversions_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
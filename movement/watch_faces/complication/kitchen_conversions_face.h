@@ -70,6 +70,7 @@ typedef struct
     uint8_t selection_index;
     bool light_held;
 } kitchen_conversions_state_t;
+#define KITCHEN_CONVERSIONS_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(kitchen_conversions_state_t))
 
 void kitchen_conversions_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void kitchen_conversions_face_activate(movement_settings_t *settings, void *context);
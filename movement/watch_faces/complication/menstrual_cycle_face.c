@@ -255,7 +255,7 @@ void menstrual_cycle_face_setup(movement_settings_t *settings, uint8_t watch_fac
     (void) settings;
     
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(menstrual_cycle_state_t));
+        *context_ptr = movement_alloc_context(sizeof(menstrual_cycle_state_t));
         memset(*context_ptr, 0, sizeof(menstrual_cycle_state_t));
         menstrual_cycle_state_t *state = ((menstrual_cycle_state_t *)*context_ptr);
 
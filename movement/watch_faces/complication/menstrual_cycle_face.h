@@ -63,6 +63,7 @@ typedef struct {
     bool period_today;
     bool reset_tracking;
 } menstrual_cycle_state_t;
+#define MENSTRUAL_CYCLE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(menstrual_cycle_state_t))
 
 void menstrual_cycle_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void menstrual_cycle_face_activate(movement_settings_t *settings, void *context);
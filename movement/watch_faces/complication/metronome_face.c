@@ -34,7 +34,7 @@ void metronome_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(metronome_state_t));
+        *context_ptr = movement_alloc_context(sizeof(metronome_state_t));
         memset(*context_ptr, 0, sizeof(metronome_state_t));
     }
 }
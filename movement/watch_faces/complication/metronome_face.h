@@ -68,6 +68,7 @@ typedef struct {
     setting_cursor_t setCur : 4;
     bool soundOn;
 } metronome_state_t;
+#define METRONOME_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(metronome_state_t))
 
 void metronome_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void metronome_face_activate(movement_settings_t *settings, void *context);
@@ -45,7 +45,7 @@ void moon_phase_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(moon_phase_state_t));
+        *context_ptr = movement_alloc_context(sizeof(moon_phase_state_t));
         memset(*context_ptr, 0, sizeof(moon_phase_state_t));
     }
 }
@@ -54,6 +54,7 @@
 typedef struct {
     uint32_t offset;
 } moon_phase_state_t;
+#define MOON_PHASE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(moon_phase_state_t))
 
 void moon_phase_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void moon_phase_face_activate(movement_settings_t *settings, void *context);
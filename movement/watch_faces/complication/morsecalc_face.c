@@ -110,11 +110,11 @@ void morsecalc_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(morsecalc_state_t)); 
+        *context_ptr = movement_alloc_context(sizeof(morsecalc_state_t)); 
         morsecalc_state_t *mcs = (morsecalc_state_t *)*context_ptr;
         morsecalc_reset_token(mcs); 
         
-        mcs->cs = (calc_state_t *) malloc(sizeof(calc_state_t));
+        mcs->cs = (calc_state_t *) movement_alloc_context(sizeof(calc_state_t));
         calc_init(mcs->cs); 
         mcs->mc = 0;
         mcs->led_is_on = 0;
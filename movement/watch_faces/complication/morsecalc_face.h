@@ -148,6 +148,7 @@ typedef struct {
 	uint8_t idxt;
 	uint8_t led_is_on;
 } morsecalc_state_t;
+#define MORSECALC_FACE_CONTEXT_SIZE (MOVEMENT_CONTEXT_SIZE(sizeof(morsecalc_state_t)) + MOVEMENT_CONTEXT_SIZE(sizeof(calc_state_t)))
 
 void morsecalc_reset_token(morsecalc_state_t *mcs);
 void morsecalc_input(morsecalc_state_t *mcs);
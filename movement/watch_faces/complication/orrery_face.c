@@ -153,7 +153,7 @@ void orrery_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(orrery_state_t));
+        *context_ptr = movement_alloc_context(sizeof(orrery_state_t));
         memset(*context_ptr, 0, sizeof(orrery_state_t));
     }
 }
@@ -84,6 +84,7 @@ typedef struct {
     double coords[3];
     uint8_t animation_state;
 } orrery_state_t;
+#define ORRERY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(orrery_state_t))
 
 void orrery_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void orrery_face_activate(movement_settings_t *settings, void *context);
@@ -42,7 +42,7 @@ void periodic_face_setup(movement_settings_t *settings, uint8_t watch_face_index
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(periodic_state_t));
+        *context_ptr = movement_alloc_context(sizeof(periodic_state_t));
         memset(*context_ptr, 0, sizeof(periodic_state_t));
     }
 }
@@ -71,6 +71,7 @@ typedef struct {
     uint8_t mode;
     uint8_t selection_index;
 } periodic_state_t;
+#define PERIODIC_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(periodic_state_t))
 
 void periodic_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void periodic_face_activate(movement_settings_t *settings, void *context);
@@ -343,7 +343,7 @@ void planetary_hours_face_setup(movement_settings_t *settings, uint8_t watch_fac
     (void) watch_face_index;
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(planetary_hours_state_t));
+        *context_ptr = movement_alloc_context(sizeof(planetary_hours_state_t));
         memset(*context_ptr, 0, sizeof(planetary_hours_state_t));
     }
 }
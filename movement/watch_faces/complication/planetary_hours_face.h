@@ -91,6 +91,7 @@ typedef struct {
     bool skip_to_current;
     sunrise_sunset_state_t sunstate;
 } planetary_hours_state_t;
+#define PLANETARY_HOURS_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(planetary_hours_state_t))
 
 void planetary_hours_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void planetary_hours_face_activate(movement_settings_t *settings, void *context);
@@ -280,7 +280,7 @@ void planetary_time_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) watch_face_index;
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(planetary_time_state_t));
+        *context_ptr = movement_alloc_context(sizeof(planetary_time_state_t));
         memset(*context_ptr, 0, sizeof(planetary_time_state_t));
     }
 }
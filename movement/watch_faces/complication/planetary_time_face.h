@@ -92,6 +92,7 @@ typedef struct {
     sunrise_sunset_state_t sunstate;
     watch_date_time scratch;
 } planetary_time_state_t;
+#define PLANETARY_TIME_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(planetary_time_state_t))
 
 void planetary_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void planetary_time_face_activate(movement_settings_t *settings, void *context);
@@ -108,7 +108,7 @@ void probability_face_setup(movement_settings_t *settings, uint8_t watch_face_in
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(probability_state_t));
+        *context_ptr = movement_alloc_context(sizeof(probability_state_t));
         memset(*context_ptr, 0, sizeof(probability_state_t));
     }
     // Emulator only: Seed random number generator
@@ -45,6 +45,7 @@ typedef struct {
     uint8_t animation_frame;
     bool is_rolling;
 } probability_state_t;
+#define PROBABILITY_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(probability_state_t))
 
 void probability_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void probability_face_activate(movement_settings_t *settings, void *context);
@@ -51,13 +51,6 @@
 
 #define PULSOMETER_FACE_FREQUENCY (1 << PULSOMETER_FACE_FREQUENCY_FACTOR)
 
-typedef struct {
-    bool measuring;
-    int16_t pulses;
-    int16_t ticks;
-    int8_t calibration;
-} pulsometer_state_t;
-
 static void pulsometer_display_title(pulsometer_state_t *pulsometer) {
     (void) pulsometer;
     watch_display_string(PULSOMETER_FACE_TITLE, 0);
@@ -139,7 +132,7 @@ void pulsometer_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        pulsometer_state_t *pulsometer = malloc(sizeof(pulsometer_state_t));
+        pulsometer_state_t *pulsometer = movement_alloc_context(sizeof(pulsometer_state_t));
 
         pulsometer->calibration = PULSOMETER_FACE_CALIBRATION_DEFAULT;
         pulsometer->pulses = 0;
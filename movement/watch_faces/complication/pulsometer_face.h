@@ -71,6 +71,14 @@
 
 #include "movement.h"
 
+typedef struct {
+    bool measuring;
+    int16_t pulses;
+    int16_t ticks;
+    int8_t calibration;
+} pulsometer_state_t;
+#define PULSOMETER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(pulsometer_state_t))
+
 void pulsometer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void pulsometer_face_activate(movement_settings_t *settings, void *context);
 bool pulsometer_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -95,6 +95,7 @@ typedef struct {
     randonaut_face_mode_t face;
     char scratchpad[10];
 } randonaut_state_t;
+#define RANDONAUT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(randonaut_state_t))
 
 void randonaut_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void randonaut_face_activate(movement_settings_t *settings, void *context);
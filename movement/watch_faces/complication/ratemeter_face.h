@@ -41,6 +41,7 @@ typedef struct {
     int16_t rate;
     int16_t ticks;
 } ratemeter_state_t;
+#define RATEMETER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(ratemeter_state_t))
 
 void ratemeter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void ratemeter_face_activate(movement_settings_t *settings, void *context);
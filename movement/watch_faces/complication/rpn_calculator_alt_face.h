@@ -78,6 +78,7 @@ typedef struct {
 
     enum calculator_mode mode;
 } calculator_state_t;
+#define RPN_CALCULATOR_ALT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(calculator_state_t))
 
 void rpn_calculator_alt_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void rpn_calculator_alt_face_activate(movement_settings_t *settings, void *context);
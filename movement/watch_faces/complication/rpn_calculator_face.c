@@ -236,7 +236,7 @@ void rpn_calculator_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(rpn_calculator_state_t));
+        *context_ptr = movement_alloc_context(sizeof(rpn_calculator_state_t));
         memset(*context_ptr, 0, sizeof(rpn_calculator_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
         rpn_calculator_state_t *state = *context_ptr;
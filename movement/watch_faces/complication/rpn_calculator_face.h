@@ -63,6 +63,7 @@ typedef struct {
     int8_t top;
     uint8_t selection;
 } rpn_calculator_state_t;
+#define RPN_CALCULATOR_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(rpn_calculator_state_t))
 
 void rpn_calculator_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void rpn_calculator_face_activate(movement_settings_t *settings, void *context);
@@ -239,7 +239,7 @@ void sailing_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sailing_state_t));
+        *context_ptr = movement_alloc_context(sizeof(sailing_state_t));
         sailing_state_t *state = (sailing_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(sailing_state_t));
         static const uint8_t default_minutes[6] = DEFAULT_MINUTES;
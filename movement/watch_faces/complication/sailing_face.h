@@ -79,6 +79,7 @@ typedef struct {
     uint8_t selection;
     sailing_mode_t mode;
 } sailing_state_t;
+#define SAILING_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(sailing_state_t))
 
 
 void sailing_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -66,7 +66,7 @@ void ships_bell_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ships_bell_state_t));
+        *context_ptr = movement_alloc_context(sizeof(ships_bell_state_t));
         memset(*context_ptr, 0, sizeof(ships_bell_state_t));
     }
 }
@@ -50,6 +50,7 @@ typedef struct {
     bool bell_enabled;
     uint8_t on_watch;
 } ships_bell_state_t;
+#define SHIPS_BELL_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(ships_bell_state_t))
 
 void ships_bell_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void ships_bell_face_activate(movement_settings_t *settings, void *context);
@@ -112,6 +112,7 @@ static void _simon_display_note(SimonNote note, simon_state_t *state) {
 
 static void _simon_play_note(SimonNote note, simon_state_t *state, bool skip_rest) {
     _simon_display_note(note, state);
+    watch_display_commit();
     switch (note) {
         case SIMON_LED_NOTE:
             if (!state->lightOff) watch_set_led_yellow();
@@ -206,7 +207,7 @@ void simon_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void)settings;
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simon_state_t));
+        *context_ptr = movement_alloc_context(sizeof(simon_state_t));
         memset(*context_ptr, 0, sizeof(simon_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens
         // only at boot.
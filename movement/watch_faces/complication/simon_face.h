@@ -89,6 +89,7 @@ typedef struct {
     uint8_t mode:6;
     SimonPlayingState playing_state;
 } simon_state_t;
+#define SIMON_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(simon_state_t))
 
 void simon_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void simon_face_activate(movement_settings_t *settings, void *context);
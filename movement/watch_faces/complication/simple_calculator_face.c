@@ -31,7 +31,7 @@ void simple_calculator_face_setup(movement_settings_t *settings, uint8_t watch_f
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_calculator_state_t));
+        *context_ptr = movement_alloc_context(sizeof(simple_calculator_state_t));
         memset(*context_ptr, 0, sizeof(simple_calculator_state_t));
     }
 }
@@ -127,6 +127,7 @@ typedef struct {
     calculator_mode_t mode;
     calculator_placeholder_t placeholder;
 } simple_calculator_state_t;
+#define SIMPLE_CALCULATOR_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(simple_calculator_state_t))
 
 void simple_calculator_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void simple_calculator_face_activate(movement_settings_t *settings, void *context);
@@ -22,7 +22,7 @@
  * SOFTWARE.
  */
 
-#if __EMSCRIPTEN__
+#if __EMSCRIPTEN__ || WATCH_HOST
 #include <time.h>
 #else
 #include "saml22j18a.h"
@@ -38,7 +38,7 @@ void simple_coin_flip_face_setup(movement_settings_t *settings, uint8_t watch_fa
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_coin_flip_state_t));
+        *context_ptr = movement_alloc_context(sizeof(simple_coin_flip_state_t));
         memset(*context_ptr, 0, sizeof(simple_coin_flip_state_t));
     }
 }
@@ -49,7 +49,7 @@ void simple_coin_flip_face_activate(movement_settings_t *settings, void *context
 }
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
+    #if __EMSCRIPTEN__ || WATCH_HOST
     return rand() % max;
     #else
     return arc4random_uniform(max);
@@ -44,6 +44,7 @@
 typedef struct {
     uint8_t animation_frame;
 } simple_coin_flip_state_t;
+#define SIMPLE_COIN_FLIP_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(simple_coin_flip_state_t))
 
 void simple_coin_flip_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void simple_coin_flip_face_activate(movement_settings_t *settings, void *context);
@@ -32,6 +32,8 @@
 
 #define PIECE_LIST_END_MARKER 0xff
 
+_Static_assert(sizeof(SCL_Game) <= SMALLCHESS_FACE_GAME_SIZE, "SMALLCHESS_FACE_GAME_SIZE is too small for SCL_Game");
+
 int8_t cpu_done_beep[] = {BUZZER_NOTE_C5, 5, BUZZER_NOTE_C6, 5, BUZZER_NOTE_C7, 5, 0};
 
 static void smallchess_init_board(smallchess_face_state_t *state) {
@@ -44,12 +46,12 @@ void smallchess_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(smallchess_face_state_t));
+        *context_ptr = movement_alloc_context(sizeof(smallchess_face_state_t));
         memset(*context_ptr, 0, sizeof(smallchess_face_state_t));
 
         /* now alloc/init the game board */
         smallchess_face_state_t *state = (smallchess_face_state_t *)*context_ptr;
-        state->game = malloc(sizeof(SCL_Game));
+        state->game = movement_alloc_context(sizeof(SCL_Game));
         smallchess_init_board(*context_ptr);
     }
 }
@@ -87,11 +89,11 @@ static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
     watch_start_character_blink('C', 100);
     SCL_gameGetRepetiotionMove(state->game, &rep_from, &rep_to);
 
-#ifndef __EMSCRIPTEN__
+#if !(__EMSCRIPTEN__ || WATCH_HOST)
     hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
 #endif
     SCL_getAIMove(state->game, 3, 0, 0, SCL_boardEvaluateStatic, NULL, 0, rep_from, rep_to, &state->ai_from_square, &state->ai_to_square, &ai_prom);
-#ifndef __EMSCRIPTEN__
+#if !(__EMSCRIPTEN__ || WATCH_HOST)
     hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_4_Val);
 #endif
 
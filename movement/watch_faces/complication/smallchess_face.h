@@ -61,6 +61,8 @@ enum smallchess_state {
 
 #define NUM_ELEMENTS(a) (sizeof(a) / sizeof(a[0]))
 #define SMALLCHESS_NUM_PIECES 16 // number of pieces each player has
+// room for the SCL_Game that game points to. smallchesslib.h can only be included once, so this is checked in smallchess_face.c.
+#define SMALLCHESS_FACE_GAME_SIZE 656
 
 typedef struct {
     void *game;
@@ -73,6 +75,7 @@ typedef struct {
     char last_move_str[7];
     uint8_t ai_from_square, ai_to_square;
 } smallchess_face_state_t;
+#define SMALLCHESS_FACE_CONTEXT_SIZE (MOVEMENT_CONTEXT_SIZE(sizeof(smallchess_face_state_t)) + MOVEMENT_CONTEXT_SIZE(SMALLCHESS_FACE_GAME_SIZE))
 
 void smallchess_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void smallchess_face_activate(movement_settings_t *settings, void *context);
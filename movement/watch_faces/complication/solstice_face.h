@@ -46,6 +46,7 @@ typedef struct {
     uint8_t year;
     uint8_t index;
 } solstice_state_t;
+#define SOLSTICE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(solstice_state_t))
 
 void solstice_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void solstice_face_activate(movement_settings_t *settings, void *context);
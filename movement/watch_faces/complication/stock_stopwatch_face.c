@@ -206,7 +206,7 @@ void stock_stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_fac
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stock_stopwatch_state_t));
+        *context_ptr = movement_alloc_context(sizeof(stock_stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stock_stopwatch_state_t));
         stock_stopwatch_state_t *state = (stock_stopwatch_state_t *)*context_ptr;
         _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
@@ -44,6 +44,7 @@ typedef struct {
     watch_date_time start_time; // while running, show the difference between this time and now
     uint32_t seconds_counted;   // set this value when paused, and show that instead.
 } stopwatch_state_t;
+#define STOPWATCH_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(stopwatch_state_t))
 
 void stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void stopwatch_face_activate(movement_settings_t *settings, void *context);
@@ -305,7 +305,7 @@ void sunrise_sunset_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sunrise_sunset_state_t));
+        *context_ptr = movement_alloc_context(sizeof(sunrise_sunset_state_t));
         memset(*context_ptr, 0, sizeof(sunrise_sunset_state_t));
     }
 }
@@ -57,6 +57,7 @@ typedef struct {
     sunrise_sunset_lat_lon_settings_t working_longitude;
     uint8_t longLatToUse;
 } sunrise_sunset_state_t;
+#define SUNRISE_SUNSET_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(sunrise_sunset_state_t))
 
 void sunrise_sunset_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void sunrise_sunset_face_activate(movement_settings_t *settings, void *context);
@@ -42,7 +42,7 @@ void tachymeter_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void)settings;
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tachymeter_state_t));
+        *context_ptr = movement_alloc_context(sizeof(tachymeter_state_t));
         memset(*context_ptr, 0, sizeof(tachymeter_state_t));
         tachymeter_state_t *state = (tachymeter_state_t *)*context_ptr;
         // Default distance
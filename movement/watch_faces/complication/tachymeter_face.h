@@ -91,6 +91,7 @@ typedef struct {
     uint32_t total_time;           // total_time = now - start_time (in cs)
     uint32_t total_speed;          // 3600 * 100 * distance / total_time
 } tachymeter_state_t;
+#define TACHYMETER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(tachymeter_state_t))
 
 void tachymeter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void tachymeter_face_activate(movement_settings_t *settings, void *context);
@@ -54,7 +54,7 @@ void tally_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tally_state_t));
+        *context_ptr = movement_alloc_context(sizeof(tally_state_t));
         memset(*context_ptr, 0, sizeof(tally_state_t));
         tally_state_t *state = (tally_state_t *)*context_ptr;
         state->tally_default_idx = 0;
@@ -197,16 +197,18 @@ bool tally_face_loop(movement_event_t event, movement_settings_t *settings, void
 
 // print tally index at the center of display.
 void print_tally(tally_state_t *state, bool sound_on) {
-    char buf[14];
     if (sound_on)
         watch_set_indicator(WATCH_INDICATOR_BELL);
     else
         watch_clear_indicator(WATCH_INDICATOR_BELL);
-    if (state->tally_idx >= 0)
-        sprintf(buf, "TA  %4d  ", (int)(state->tally_idx)); // center of LCD display
-    else
-        sprintf(buf, "TA     %-3d", (int)(state->tally_idx)); // center of LCD display
-    watch_display_string(buf, 0);
+    watch_display_string("TA  ", 0);
+    if (state->tally_idx >= 0) {
+        watch_display_int(state->tally_idx, 4, 4, WATCH_DISPLAY_PAD_SPACE); // center of LCD display
+        watch_display_string("  ", 8);
+    } else {
+        watch_display_string("   ", 4);
+        watch_display_int(state->tally_idx, 7, 3, WATCH_DISPLAY_PAD_LEFT); // center of LCD display
+    }
 }
 
 void tally_face_resign(movement_settings_t *settings, void *context) {
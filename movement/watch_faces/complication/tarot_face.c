@@ -212,7 +212,7 @@ void tarot_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tarot_state_t));
+        *context_ptr = movement_alloc_context(sizeof(tarot_state_t));
         memset(*context_ptr, 0, sizeof(tarot_state_t));
     }
     // Emulator only: Seed random number generator
@@ -72,6 +72,7 @@ typedef struct {
     bool major_arcana_only;
     bool is_picking;
 } tarot_state_t;
+#define TAROT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(tarot_state_t))
 
 void tarot_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void tarot_face_activate(movement_settings_t *settings, void *context);
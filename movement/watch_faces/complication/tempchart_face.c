@@ -36,10 +36,18 @@ struct {
     uint16_t num_div;
 } tempchart_state;
 
+// The part of tempchart_state that has changed since it was last saved
+static filesystem_dirty_range_t tempchart_dirty;
+
 static void tempchart_save(void) {
     filesystem_write_file("tempchart.ini", (char*)&tempchart_state, sizeof(tempchart_state));
 }
 
+static void tempchart_save_changes(void) {
+    // Only the cells that changed get written, which usually leaves most of the file's blocks alone
+    filesystem_write_dirty("tempchart.ini", (char*)&tempchart_state, &tempchart_dirty);
+}
+
 void tempchart_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     // These next two lines just silence the compiler warnings associated with unused parameters.
     // We have no use for the settings or the watch_face_index, so we make that explicit here.
@@ -113,11 +121,13 @@ bool tempchart_face_loop(movement_event_t event, movement_settings_t *settings,
               tempchart_state.num_div++;
               for (int i = 0; i < 24 * 70; i++)
                 tempchart_state.stat[i] = (tempchart_state.stat[i] + 1) >> 1; // So that we don't lose 1
+              filesystem_mark_dirty(&tempchart_dirty, 0, sizeof(tempchart_state));
             }
             tempchart_state.stat[date_time.unit.hour+temp*24]++;
+            filesystem_mark_dirty(&tempchart_dirty, date_time.unit.hour + temp * 24, 1);
 
             if (date_time.unit.hour == 0 && date_time.unit.minute == 10)
-                tempchart_save();
+                tempchart_save_changes();
 
             break;
 
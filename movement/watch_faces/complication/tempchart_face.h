@@ -55,4 +55,6 @@ bool tempchart_face_wants_background_task(movement_settings_t *settings, void *c
     tempchart_face_wants_background_task, \
 })
 
+#define TEMPCHART_FACE_CONTEXT_SIZE 0
+
 #endif // TEMPCHART_FACE_H_
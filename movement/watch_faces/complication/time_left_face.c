@@ -209,7 +209,7 @@ void time_left_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(time_left_state_t));
+        *context_ptr = movement_alloc_context(sizeof(time_left_state_t));
         memset(*context_ptr, 0, sizeof(time_left_state_t));
         time_left_state_t *state = (time_left_state_t *)*context_ptr;
         state->birth_date.reg = watch_get_backup_data(2);
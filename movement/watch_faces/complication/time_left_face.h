@@ -74,6 +74,7 @@ typedef struct {
     movement_birthdate_t birth_date_when_activated;
     movement_birthdate_t target_date;
 } time_left_state_t;
+#define TIME_LEFT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(time_left_state_t))
 
 void time_left_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void time_left_face_activate(movement_settings_t *settings, void *context);
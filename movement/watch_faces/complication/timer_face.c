@@ -193,7 +193,7 @@ void timer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) settings;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(timer_state_t));
+        *context_ptr = movement_alloc_context(sizeof(timer_state_t));
         timer_state_t *state = (timer_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(timer_state_t));
         state->watch_face_index = watch_face_index;
@@ -85,6 +85,7 @@ typedef struct {
     timer_mode_t mode : 3;
     bool quick_cycle : 1;
 } timer_state_t;
+#define TIMER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(timer_state_t))
 
 void timer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void timer_face_activate(movement_settings_t *settings, void *context);
@@ -112,7 +112,7 @@ void tomato_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tomato_state_t));
+        *context_ptr = movement_alloc_context(sizeof(tomato_state_t));
         tomato_state_t *state = (tomato_state_t*)*context_ptr;
         memset(*context_ptr, 0, sizeof(tomato_state_t));
         state->mode=tomato_ready;
@@ -66,6 +66,7 @@ typedef struct {
     uint8_t done_count;
     bool visible;
 } tomato_state_t;
+#define TOMATO_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(tomato_state_t))
 
 void tomato_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void tomato_face_activate(movement_settings_t *settings, void *context);
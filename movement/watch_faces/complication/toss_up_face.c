@@ -25,7 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "toss_up_face.h"
-#if __EMSCRIPTEN__
+#if __EMSCRIPTEN__ || WATCH_HOST
 #include <time.h>
 #else
 #include "saml22j18a.h"
@@ -48,7 +48,7 @@ void toss_up_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) watch_face_index;
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(toss_up_state_t));
+        *context_ptr = movement_alloc_context(sizeof(toss_up_state_t));
         memset(*context_ptr, 0, sizeof(toss_up_state_t));
         toss_up_state_t *state = (toss_up_state_t *)*context_ptr;
 
@@ -247,7 +247,7 @@ uint8_t divine_bit(void) {
 /** @brief get 32 True Random Number bits
  */
 uint32_t get_true_entropy(void) {
-    #if __EMSCRIPTEN__
+    #if __EMSCRIPTEN__ || WATCH_HOST
     return rand() % INT32_MAX;
     #else
     hri_mclk_set_APBCMASK_TRNG_bit(MCLK);
@@ -91,6 +91,7 @@ typedef struct {
     uint8_t animation;
     bool animate;
 } toss_up_state_t;
+#define TOSS_UP_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(toss_up_state_t))
 
 uint32_t get_true_entropy(void);
 uint8_t divine_bit(void);
@@ -39,10 +39,6 @@
 #include "TOTP.h"
 #include "base32.h"
 
-#ifndef TOTP_FACE_MAX_KEY_LENGTH
-#define TOTP_FACE_MAX_KEY_LENGTH 128
-#endif
-
 typedef struct {
     unsigned char labels[2];
     hmac_alg algorithm;
@@ -168,8 +164,8 @@ void totp_face_setup(movement_settings_t *settings, uint8_t watch_face_index, vo
     totp_validate_key_lengths();
 
     if (*context_ptr == NULL) {
-        totp_state_t *totp = malloc(sizeof(totp_state_t));
-        totp->current_decoded_key = malloc(TOTP_FACE_MAX_KEY_LENGTH);
+        totp_state_t *totp = movement_alloc_context(sizeof(totp_state_t));
+        totp->current_decoded_key = movement_alloc_context(TOTP_FACE_MAX_KEY_LENGTH);
         *context_ptr = totp;
     }
 }
@@ -69,6 +69,10 @@
 
 #include "movement.h"
 
+#ifndef TOTP_FACE_MAX_KEY_LENGTH
+#define TOTP_FACE_MAX_KEY_LENGTH 128
+#endif
+
 typedef struct {
     uint32_t timestamp;
     uint8_t steps;
@@ -77,6 +81,7 @@ typedef struct {
     uint8_t *current_decoded_key;
     size_t current_decoded_key_length;
 } totp_state_t;
+#define TOTP_FACE_CONTEXT_SIZE (MOVEMENT_CONTEXT_SIZE(sizeof(totp_state_t)) + MOVEMENT_CONTEXT_SIZE(TOTP_FACE_MAX_KEY_LENGTH))
 
 void totp_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void totp_face_activate(movement_settings_t *settings, void *context);
@@ -131,14 +131,15 @@ static void totp_face_lfs_read_file(char *filename) {
     // For 'format' of file, see comment at top.
     const size_t uri_start_len = strlen(TOTP_URI_START);
 
-    if (!filesystem_file_exists(filename)) {
+    filesystem_line_reader_t reader;
+    if (!filesystem_open_line_reader(&reader, filename)) {
         printf("TOTP file error: %s\n", filename);
         return;
     }
 
     char line[256];
-    int32_t offset = 0, old_offset = 0;
-    while (old_offset = offset, filesystem_read_line(filename, line, &offset, 255) && strlen(line)) {
+    int32_t old_offset = 0;
+    while (old_offset = filesystem_line_reader_tell(&reader), filesystem_read_next_line(&reader, line, 255) && strlen(line)) {
         if (num_totp_records == MAX_TOTP_RECORDS) {
             printf("TOTP max records: %d\n", MAX_TOTP_RECORDS);
             break;
@@ -187,13 +188,15 @@ static void totp_face_lfs_read_file(char *filename) {
             printf("TOTP missing secret: %s\n", line);
         }
     }
+
+    filesystem_close_line_reader(&reader);
 }
 
 void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(totp_lfs_state_t));
+        *context_ptr = movement_alloc_context(sizeof(totp_lfs_state_t));
     }
 
 #if !(__EMSCRIPTEN__)
@@ -205,18 +208,22 @@ void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index
 
 static uint8_t *totp_face_lfs_get_file_secret(struct totp_record *record) {
     char buffer[BASE32_LEN(MAX_TOTP_SECRET_SIZE) + 1];
-    int32_t file_secret_offset = record->file_secret_offset;
-
-    /* TODO filesystem_read_line is quite inefficient. Consider writing a new function,
-     * and keeping the file open?
-     */
-    if (!filesystem_read_line(TOTP_FILE, buffer, &file_secret_offset, record->file_secret_length + 1)) {
+    filesystem_line_reader_t reader;
+
+    // the secret runs to the next '&' or the end of the line; its length was noted when the file was first read.
+    bool success = filesystem_open_line_reader(&reader, TOTP_FILE);
+    if (success) {
+        success = filesystem_line_reader_seek(&reader, record->file_secret_offset) &&
+                  filesystem_read_next_line(&reader, buffer, record->file_secret_length);
+        filesystem_close_line_reader(&reader);
+    }
+    if (!success) {
         /* Shouldn't happen at this point. Return current_secret, which is misleading but will not cause a crash. */
         printf("TOTP can't read expected secret from totp_uris.txt (failed readline)\n");
         return current_secret;
     }
     if (base32_decode((unsigned char *)buffer, current_secret) != record->secret_size) {
-        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; failed at offset %d; read to %ld\n", buffer, record->file_secret_offset, file_secret_offset);
+        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; failed at offset %d\n", buffer, record->file_secret_offset);
     }
     return current_secret;
 }
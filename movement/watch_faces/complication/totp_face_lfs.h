@@ -60,6 +60,7 @@ typedef struct {
     uint32_t current_code;
     uint8_t current_index;
 } totp_lfs_state_t;
+#define TOTP_FACE_LFS_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(totp_lfs_state_t))
 
 void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void totp_face_lfs_activate(movement_settings_t *settings, void *context);
@@ -68,7 +68,7 @@ void tuning_tones_face_setup(movement_settings_t *settings, uint8_t watch_face_i
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        tuning_tones_state_t *state = malloc(sizeof *state);
+        tuning_tones_state_t *state = movement_alloc_context(sizeof *state);
         memset(state, 0, sizeof *state);
         state->note_ind = 9;
         *context_ptr = state;
@@ -39,6 +39,7 @@ typedef struct {
     bool playing;
     size_t note_ind;
 } tuning_tones_state_t;
+#define TUNING_TONES_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(tuning_tones_state_t))
 
 void tuning_tones_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void tuning_tones_face_activate(movement_settings_t *settings, void *context);
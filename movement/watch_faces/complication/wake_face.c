@@ -70,7 +70,7 @@ void wake_face_setup(movement_settings_t *settings, uint8_t watch_face_index, vo
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wake_face_state_t));
+        *context_ptr = movement_alloc_context(sizeof(wake_face_state_t));
         wake_face_state_t *state = (wake_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(wake_face_state_t));
 
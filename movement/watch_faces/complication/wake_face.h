@@ -47,6 +47,7 @@ typedef struct {
     uint32_t minute : 6;
     uint32_t mode : 1;
 } wake_face_state_t;
+#define WAKE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(wake_face_state_t))
 
 void wake_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void wake_face_activate(movement_settings_t *settings, void *context);
@@ -16,7 +16,7 @@ void wareki_setup(movement_settings_t *settings, uint8_t watch_face_index, void
     //printf("wareki_setup() \n");
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wareki_state_t));
+        *context_ptr = movement_alloc_context(sizeof(wareki_state_t));
         memset(*context_ptr, 0, sizeof(wareki_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
 
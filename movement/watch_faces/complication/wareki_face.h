@@ -13,6 +13,7 @@ typedef struct {
     uint32_t start_year;    //Year when this screen was launched
     uint32_t real_year;     //The actual current year     
 } wareki_state_t;
+#define WAREKI_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(wareki_state_t))
 
 
 void wareki_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -131,6 +131,7 @@ typedef struct {
     bool known_wrong_letters[WORDLE_NUM_VALID_LETTERS];
     uint32_t day_last_game_started;
 } wordle_state_t;
+#define WORDLE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(wordle_state_t))
 
 void wordle_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void wordle_face_activate(movement_settings_t *settings, void *context);
@@ -30,7 +30,7 @@ void beeps_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(beeps_state_t));
+        *context_ptr = movement_alloc_context(sizeof(beeps_state_t));
         memset(*context_ptr, 0, sizeof(beeps_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
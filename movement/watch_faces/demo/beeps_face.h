@@ -43,6 +43,7 @@
 typedef struct {
     uint8_t frequency;
 } beeps_state_t;
+#define BEEPS_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(beeps_state_t))
 
 void beeps_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void beeps_face_activate(movement_settings_t *settings, void *context);
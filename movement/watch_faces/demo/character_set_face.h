@@ -51,4 +51,6 @@ void character_set_face_resign(movement_settings_t *settings, void *context);
     NULL, \
 })
 
+#define CHARACTER_SET_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(char))
+
 #endif // CHARACTER_SET_FACE_H_
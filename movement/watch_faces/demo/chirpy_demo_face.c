@@ -28,33 +28,6 @@
 #include "chirpy_tx.h"
 #include "filesystem.h"
 
-typedef enum {
-    CDM_CHOOSE = 0,
-    CDM_CHIRPING,
-} chirpy_demo_mode_t;
-
-typedef enum {
-    CDP_SCALE = 0,
-    CDP_INFO_SHORT,
-    CDP_INFO_LONG,
-    CDP_INFO_NANOSEC,
-} chirpy_demo_program_t;
-
-typedef struct {
-    // Current mode
-    chirpy_demo_mode_t mode;
-
-    // Selected program
-    chirpy_demo_program_t program;
-
-    // Helps us handle 1/64 ticks during transmission; including countdown timer
-    chirpy_tick_state_t tick_state;
-
-    // Used by chirpy encoder during transmission
-    chirpy_encoder_state_t encoder_state;
-
-} chirpy_demo_state_t;
-
 static uint8_t long_data_str[] =
     "There once was a ship that put to sea\n"
     "The name of the ship was the Billy of Tea\n"
@@ -100,7 +73,7 @@ void chirpy_demo_face_setup(movement_settings_t *settings, uint8_t watch_face_in
     (void)settings;
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(chirpy_demo_state_t));
+        *context_ptr = movement_alloc_context(sizeof(chirpy_demo_state_t));
         memset(*context_ptr, 0, sizeof(chirpy_demo_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -118,17 +91,18 @@ void chirpy_demo_face_activate(movement_settings_t *settings, void *context) {
     // Do we have nanosec data? Load it.
     int32_t sz = filesystem_get_file_size(NANOSEC_INI_FILE_NAME);
     if (sz > 0) {
-        // We will free this in resign.
-        // I don't like any kind of dynamic allocation in long-running embedded software...
-        // But there's no way around it here; I don't want to hard-wire (and squat) any fixed size structure
-        // Nanosec data may change in the future too
-        nanosec_buffer_size = sz + 2;
-        nanosec_buffer = malloc(nanosec_buffer_size);
-        // First two bytes of prefix, so Chirpy RX can recognize this data type
-        nanosec_buffer[0] = 0xc0;
-        nanosec_buffer[1] = 0x00;
-        // Read file
-        filesystem_read_file(NANOSEC_INI_FILE_NAME, (char*)&nanosec_buffer[2], sz);
+        // Movement takes this back when we resign.
+        // I don't want to hard-wire (and squat) any fixed size structure; nanosec data may change in the future too.
+        // If it doesn't fit in scratch space, we just don't offer to transmit it.
+        nanosec_buffer = movement_alloc_scratch(sz + 2);
+        if (nanosec_buffer != 0) {
+            nanosec_buffer_size = sz + 2;
+            // First two bytes of prefix, so Chirpy RX can recognize this data type
+            nanosec_buffer[0] = 0xc0;
+            nanosec_buffer[1] = 0x00;
+            // Read file
+            filesystem_read_file(NANOSEC_INI_FILE_NAME, (char*)&nanosec_buffer[2], sz);
+        }
     }
 }
 
@@ -327,9 +301,6 @@ void chirpy_demo_face_resign(movement_settings_t *settings, void *context) {
     (void)settings;
     (void)context;
 
-    if (nanosec_buffer != 0) {
-        free(nanosec_buffer);
-        nanosec_buffer = 0;
-        nanosec_buffer_size = 0;
-    }
+    nanosec_buffer = 0;
+    nanosec_buffer_size = 0;
 }
@@ -27,27 +27,11 @@
 #include "demo_face.h"
 #include "watch.h"
 
-typedef enum {
-    DEMO_FACE_TIME = 0,
-    DEMO_FACE_WORLD_TIME,
-    DEMO_FACE_BEATS,
-    DEMO_FACE_TOTP,
-    DEMO_FACE_TEMP_F,
-    DEMO_FACE_TEMP_C,
-    DEMO_FACE_TEMP_LOG_1,
-    DEMO_FACE_TEMP_LOG_2,
-    DEMO_FACE_DAY_ONE,
-    DEMO_FACE_STOPWATCH,
-    DEMO_FACE_PULSOMETER,
-    DEMO_FACE_BATTERY_VOLTAGE,
-    DEMO_FACE_NUM_FACES
-} demo_face_index_t;
-
 void demo_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(demo_face_index_t));
+        *context_ptr = movement_alloc_context(sizeof(demo_face_index_t));
         memset(*context_ptr, 0, sizeof(demo_face_index_t));
     }
 }
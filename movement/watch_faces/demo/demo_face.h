@@ -38,6 +38,23 @@
 
 #include "movement.h"
 
+typedef enum {
+    DEMO_FACE_TIME = 0,
+    DEMO_FACE_WORLD_TIME,
+    DEMO_FACE_BEATS,
+    DEMO_FACE_TOTP,
+    DEMO_FACE_TEMP_F,
+    DEMO_FACE_TEMP_C,
+    DEMO_FACE_TEMP_LOG_1,
+    DEMO_FACE_TEMP_LOG_2,
+    DEMO_FACE_DAY_ONE,
+    DEMO_FACE_STOPWATCH,
+    DEMO_FACE_PULSOMETER,
+    DEMO_FACE_BATTERY_VOLTAGE,
+    DEMO_FACE_NUM_FACES
+} demo_face_index_t;
+#define DEMO_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(demo_face_index_t))
+
 void demo_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void demo_face_activate(movement_settings_t *settings, void *context);
 bool demo_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -27,8 +27,8 @@
 #include "frequency_correction_face.h"
 
 // NOTE: since this face deals directly with the SAM L22's SUPC and RTC registers,
-// it won't build for the simulator or really do anything. so let's not.
-#ifndef __EMSCRIPTEN__
+// it won't build for the simulator or the host, or really do anything there. so let's not.
+#if !(__EMSCRIPTEN__ || WATCH_HOST)
 
 // Waveform output. Comes out on pin A1 of the 9-pin connector. Output is enabled
 // when the watch face is activated and disabled when deactivated.
@@ -73,7 +73,7 @@ void frequency_correction_face_setup(movement_settings_t *settings, uint8_t watc
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(frequency_correction_state_t));
+        *context_ptr = movement_alloc_context(sizeof(frequency_correction_state_t));
         frequency_correction_state_t *state = (frequency_correction_state_t *)*context_ptr;
         state->period_event_output = 0;
     }
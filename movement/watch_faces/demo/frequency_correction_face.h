@@ -42,6 +42,7 @@
 typedef struct {
     uint8_t period_event_output;
 } frequency_correction_state_t;
+#define FREQUENCY_CORRECTION_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(frequency_correction_state_t))
 
 void frequency_correction_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void frequency_correction_face_activate(movement_settings_t *settings, void *context);
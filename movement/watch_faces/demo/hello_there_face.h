@@ -38,6 +38,7 @@ typedef struct {
     uint8_t current_word;
     bool animating;
 } hello_there_state_t;
+#define HELLO_THERE_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(hello_there_state_t))
 
 void hello_there_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void hello_there_face_activate(movement_settings_t *settings, void *context);
@@ -39,17 +39,17 @@
 static void _lis2dw_logging_face_update_display(movement_settings_t *settings, lis2dw_logger_state_t *logger_state, lis2dw_wakeup_source wakeup_source) {
     char buf[14];
     char time_indication_character;
-    int8_t pos;
+    int32_t pos;
     watch_date_time date_time;
+    lis2dw_logger_data_point_t data_point;
     bool set_leading_zero = false;
 
     if (logger_state->log_ticks) {
-        pos = (logger_state->data_points - 1 - logger_state->display_index) % LIS2DW_LOGGING_NUM_DATA_POINTS;
-        if (pos < 0) {
+        pos = timeseries_count(&logger_state->log) - 1 - logger_state->display_index;
+        if (pos < 0 || timeseries_read(&logger_state->log, pos, 1, &date_time.reg, &data_point) != 1) {
             watch_clear_colon();
             sprintf(buf, "NO   data ");
         } else {
-            date_time = logger_state->data[pos].timestamp;
             watch_set_colon();
             if (!settings->bit.clock_mode_24h) {
                 if (date_time.unit.hour > 11) watch_set_indicator(WATCH_INDICATOR_PM);
@@ -62,16 +62,16 @@ static void _lis2dw_logging_face_update_display(movement_settings_t *settings, l
             }
             switch (logger_state->axis_index) {
                 case 0:
-                    sprintf(buf, "3A%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].x_interrupts + logger_state->data[pos].y_interrupts + logger_state->data[pos].z_interrupts);
+                    sprintf(buf, "3A%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, data_point.x_interrupts + data_point.y_interrupts + data_point.z_interrupts);
                     break;
                 case 1:
-                    sprintf(buf, "XA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].x_interrupts);
+                    sprintf(buf, "XA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, data_point.x_interrupts);
                     break;
                 case 2:
-                    sprintf(buf, "YA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].y_interrupts);
+                    sprintf(buf, "YA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, data_point.y_interrupts);
                     break;
                 case 3:
-                    sprintf(buf, "ZA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].z_interrupts);
+                    sprintf(buf, "ZA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, data_point.z_interrupts);
                     break;
             }
         }
@@ -106,12 +106,12 @@ static void _lis2dw_logging_face_log_data(lis2dw_logger_state_t *logger_state) {
     // // then roll the minute back.
     date_time.unit.minute = (date_time.unit.minute + 45) % 60;
 
-    size_t pos = logger_state->data_points % LIS2DW_LOGGING_NUM_DATA_POINTS;
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].x_interrupts = logger_state->x_interrupts_this_hour;
-    logger_state->data[pos].y_interrupts = logger_state->y_interrupts_this_hour;
-    logger_state->data[pos].z_interrupts = logger_state->z_interrupts_this_hour;
-    logger_state->data_points++;
+    lis2dw_logger_data_point_t data_point = {
+        .x_interrupts = logger_state->x_interrupts_this_hour,
+        .y_interrupts = logger_state->y_interrupts_this_hour,
+        .z_interrupts = logger_state->z_interrupts_this_hour,
+    };
+    timeseries_append(&logger_state->log, date_time.reg, &data_point);
     logger_state->x_interrupts_this_hour = 0;
     logger_state->y_interrupts_this_hour = 0;
     logger_state->z_interrupts_this_hour = 0;
@@ -121,8 +121,10 @@ void lis2dw_logging_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lis2dw_logger_state_t));
+        *context_ptr = movement_alloc_context(sizeof(lis2dw_logger_state_t));
         memset(*context_ptr, 0, sizeof(lis2dw_logger_state_t));
+        lis2dw_logger_state_t *logger_state = (lis2dw_logger_state_t *)*context_ptr;
+        timeseries_init(&logger_state->log, "accellog", sizeof(lis2dw_logger_data_point_t), LIS2DW_LOGGING_DATA_POINTS_PER_FILE, LIS2DW_LOGGING_NUM_FILES);
         watch_enable_i2c();
         lis2dw_begin();
         lis2dw_set_low_power_mode(LIS2DW_LP_MODE_2); // lowest power 14-bit mode, 25 Hz is 3.5 µA @ 1.8V w/ low noise, 3µA without
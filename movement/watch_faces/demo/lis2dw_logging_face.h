@@ -35,11 +35,16 @@
 
 #include "movement.h"
 #include "watch.h"
+#include "timeseries.h"
 
 #define LIS2DW_LOGGING_NUM_DATA_POINTS (96)
 
+// data points are logged to "accellog.0" through "accellog.7". 15 to a file fits each file in a flash row, and
+// keeps at least 96 of them.
+#define LIS2DW_LOGGING_DATA_POINTS_PER_FILE (15)
+#define LIS2DW_LOGGING_NUM_FILES (8)
+
 typedef struct {
-    watch_date_time timestamp;
     uint32_t x_interrupts;
     uint32_t y_interrupts;
     uint32_t z_interrupts;
@@ -49,13 +54,13 @@ typedef struct {
     uint8_t display_index;  // the index we are displaying on screen
     uint8_t axis_index;     // the index we are displaying on screen
     uint8_t log_ticks;      // when the user taps the ALARM button, we enter log mode
-    int32_t data_points;    // the absolute number of data points logged
     uint8_t interrupts[3];  // the number of interrupts we have logged in each of the last 3 minutes
     uint32_t x_interrupts_this_hour;  // the number of interrupts we have logged in the last hour
     uint32_t y_interrupts_this_hour;  // the number of interrupts we have logged in the last hour
     uint32_t z_interrupts_this_hour;  // the number of interrupts we have logged in the last hour
-    lis2dw_logger_data_point_t data[LIS2DW_LOGGING_NUM_DATA_POINTS];
+    timeseries_t log;       // lis2dw_logger_data_point_t records, timestamped with watch_date_time.reg
 } lis2dw_logger_state_t;
+#define LIS2DW_LOGGING_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(lis2dw_logger_state_t))
 
 void lis2dw_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void lis2dw_logging_face_activate(movement_settings_t *settings, void *context);
@@ -51,4 +51,6 @@ void voltage_face_resign(movement_settings_t *settings, void *context);
     NULL, \
 })
 
+#define VOLTAGE_FACE_CONTEXT_SIZE 0
+
 #endif // VOLTAGE_FACE_H_
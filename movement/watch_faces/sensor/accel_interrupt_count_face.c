@@ -59,7 +59,7 @@ void accel_interrupt_count_face_setup(movement_settings_t *settings, uint8_t wat
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(accel_interrupt_count_state_t));
+        *context_ptr = movement_alloc_context(sizeof(accel_interrupt_count_state_t));
         memset(*context_ptr, 0, sizeof(accel_interrupt_count_state_t));
         ptr_to_count = &((accel_interrupt_count_state_t *)*context_ptr)->count;
         watch_enable_i2c();
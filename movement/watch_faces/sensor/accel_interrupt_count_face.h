@@ -42,6 +42,7 @@ typedef struct {
     bool running;
     bool is_setting;
 } accel_interrupt_count_state_t;
+#define ACCEL_INTERRUPT_COUNT_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(accel_interrupt_count_state_t))
 
 void accel_interrupt_count_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void accel_interrupt_count_face_activate(movement_settings_t *settings, void *context);
@@ -70,7 +70,7 @@ void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, ui
     (void) watch_face_index;
     accelerometer_data_acquisition_state_t *state = (accelerometer_data_acquisition_state_t *)*context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(accelerometer_data_acquisition_state_t));
+        *context_ptr = movement_alloc_context(sizeof(accelerometer_data_acquisition_state_t));
         memset(*context_ptr, 0, sizeof(accelerometer_data_acquisition_state_t));
         state = (accelerometer_data_acquisition_state_t *)*context_ptr;
         state->beep_with_countdown = true;
@@ -100,6 +100,7 @@ typedef struct {
     accelerometer_data_acquisition_record_t records[32];
     uint16_t pos;
 } accelerometer_data_acquisition_state_t;
+#define ACCELEROMETER_DATA_ACQUISITION_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(accelerometer_data_acquisition_state_t))
 
 void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void accelerometer_data_acquisition_face_activate(movement_settings_t *settings, void *context);
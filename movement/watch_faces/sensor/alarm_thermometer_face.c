@@ -52,7 +52,7 @@ void alarm_thermometer_face_setup(movement_settings_t *settings, uint8_t watch_f
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_thermometer_state_t));
+        *context_ptr = movement_alloc_context(sizeof(alarm_thermometer_state_t));
         memset(*context_ptr, 0, sizeof(alarm_thermometer_state_t));
     }
 }
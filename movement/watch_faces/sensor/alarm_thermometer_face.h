@@ -57,6 +57,7 @@ typedef struct {
     int last[LAST_SIZE];
     alarm_thermometer_mode_t mode;
 } alarm_thermometer_state_t;
+#define ALARM_THERMOMETER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(alarm_thermometer_state_t))
 
 void alarm_thermometer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void alarm_thermometer_face_activate(movement_settings_t *settings, void *context);
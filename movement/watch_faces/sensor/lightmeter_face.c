@@ -35,7 +35,7 @@ void lightmeter_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lightmeter_state_t));
+        *context_ptr = movement_alloc_context(sizeof(lightmeter_state_t));
         lightmeter_state_t *state = (lightmeter_state_t*) *context_ptr;
         state->waiting_for_conversion = 0;
         state->lux = 0.0;
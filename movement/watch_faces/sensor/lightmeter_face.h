@@ -158,6 +158,7 @@ typedef struct {
     float lux;
     int mode; 
 } lightmeter_state_t;
+#define LIGHTMETER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(lightmeter_state_t))
 
 static const opt3001_Config_t lightmeter_takeNewReading = { 
     .RangeNumber = 0B1100,
@@ -27,17 +27,22 @@
 #include "minmax_face.h"
 #include "thermistor_driver.h"
 #include "watch.h"
+#include "watch_utility.h"
 
 
 static float _get_displayed_temperature_c(minmax_state_t *state){
-    float min_temp = 1000;
-    float max_temp = -1000;
-    for(int i = 0; i < LOGGING_DATA_POINTS; i++){
-      if(state->hourly_maxs[i] > max_temp){
-	  max_temp = state->hourly_maxs[i];
+    float min_temp = state->this_hour.min;
+    float max_temp = state->this_hour.max;
+    // the hours before this one that still fall within the last 24
+    minmax_hour_t hours[LOGGING_DATA_POINTS - 1];
+    uint32_t first = timeseries_find(&state->log, state->hour_start - (LOGGING_DATA_POINTS - 1) * 3600);
+    uint32_t num_hours = timeseries_read(&state->log, first, LOGGING_DATA_POINTS - 1, NULL, hours);
+    for(uint32_t i = 0; i < num_hours; i++){
+      if(hours[i].max > max_temp){
+	  max_temp = hours[i].max;
 	}
-      if(state->hourly_mins[i] < min_temp){
-	  min_temp = state->hourly_mins[i];
+      if(hours[i].min < min_temp){
+	  min_temp = hours[i].min;
 	}
     }
     if(state->show_min) return min_temp;
@@ -47,29 +52,31 @@ static float _get_displayed_temperature_c(minmax_state_t *state){
 
 static void _minmax_face_log_data(minmax_state_t *logger_state) {
     thermistor_driver_enable();
-    size_t pos = (size_t) watch_rtc_get_date_time().unit.hour;
     float temp_c = thermistor_driver_get_temperature();
-    // If no data yet, initialise with current temperature
+    thermistor_driver_disable();
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    uint32_t hour_start = now - now % 3600;
+    // On new hour, log the hour that just ended
+    if(logger_state->have_logged && hour_start != logger_state->hour_start){
+      // written out right away, so that a reset loses at most the hour in progress
+      timeseries_append(&logger_state->log, logger_state->hour_start, &logger_state->this_hour);
+      timeseries_flush(&logger_state->log);
+      logger_state->have_logged = false;
+    }
+    // If nothing logged yet this hour, initialise with current temperature
     if(!logger_state->have_logged){
       logger_state->have_logged = true;
-      for(int i=0; i<LOGGING_DATA_POINTS; i++){
-	logger_state->hourly_mins[i] = temp_c;
-	logger_state->hourly_maxs[i] = temp_c;
-      }
-    }
-    // On new hour, update lists to current temperature
-    else if(watch_rtc_get_date_time().unit.minute < 2){
-      logger_state->hourly_mins[pos] = temp_c;
-      logger_state->hourly_maxs[pos] = temp_c;
+      logger_state->hour_start = hour_start;
+      logger_state->this_hour.min = temp_c;
+      logger_state->this_hour.max = temp_c;
     }
     // Log hourly highs and lows
-    else if(logger_state->hourly_mins[pos] > temp_c){
-      logger_state->hourly_mins[pos] = temp_c;
+    else if(logger_state->this_hour.min > temp_c){
+      logger_state->this_hour.min = temp_c;
     }
-    else if(logger_state->hourly_maxs[pos] < temp_c){
-      logger_state->hourly_maxs[pos] = temp_c;
+    else if(logger_state->this_hour.max < temp_c){
+      logger_state->this_hour.max = temp_c;
     }
-    thermistor_driver_disable();
 }
 
 static void _minmax_face_update_display(float temperature_c, bool in_fahrenheit) {
@@ -87,8 +94,10 @@ void minmax_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(minmax_state_t));
+        *context_ptr = movement_alloc_context(sizeof(minmax_state_t));
         memset(*context_ptr, 0, sizeof(minmax_state_t));
+        minmax_state_t *state = (minmax_state_t *)*context_ptr;
+        timeseries_init(&state->log, "minmax", sizeof(minmax_hour_t), MINMAX_HOURS_PER_FILE, MINMAX_NUM_FILES);
     }
 }
 
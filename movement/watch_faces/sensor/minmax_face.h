@@ -27,16 +27,22 @@
 
 #include "movement.h"
 #include "watch.h"
+#include "timeseries.h"
 
 #define LOGGING_DATA_POINTS (24)
 
+// completed hours are logged to "minmax.0" through "minmax.2", which hold at least 42 hours between them.
+#define MINMAX_HOURS_PER_FILE (21)
+#define MINMAX_NUM_FILES (3)
+
 /*
  * Log for the min. and max. temperature over the last 24h.
  *
  * Temperature is logged once a minute, every minute. Results are
  * stored, noting the highest and lowest temperatures observed within
  * any given hour. The watch face then displays the minimum or maximum
- * temperature recorded over the last 24h.
+ * temperature recorded over the last 24h. Completed hours are kept on
+ * the filesystem, so they survive a reset.
  *
  * A long press of the light button changes units between Celsius and
  * Fahrenheit. Pressing the alarm button switches between displaying the
@@ -44,12 +50,19 @@
  * the watch face will eventually time out and return home.
  */
 
+typedef struct {
+  float min;
+  float max;
+} minmax_hour_t;
+
 typedef struct {
   bool show_min;
-  bool have_logged;
-  float hourly_mins[LOGGING_DATA_POINTS];
-  float hourly_maxs[LOGGING_DATA_POINTS];
+  bool have_logged;          // whether this_hour holds any readings yet
+  uint32_t hour_start;       // local UNIX time of the start of the hour being logged
+  minmax_hour_t this_hour;
+  timeseries_t log;          // completed hours, timestamped with their hour_start
 } minmax_state_t;
+#define MINMAX_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(minmax_state_t))
 
 void minmax_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void minmax_face_activate(movement_settings_t *settings, void *context);
@@ -31,17 +31,18 @@
 static void _thermistor_logging_face_log_data(thermistor_logger_state_t *logger_state) {
     thermistor_driver_enable();
     watch_date_time date_time = watch_rtc_get_date_time();
-    size_t pos = logger_state->data_points % THERMISTOR_LOGGING_NUM_DATA_POINTS;
-
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = thermistor_driver_get_temperature();
-    logger_state->data_points++;
-
+    float temperature_c = thermistor_driver_get_temperature();
     thermistor_driver_disable();
+
+    // an hour's reading is worth a flash write of its own; left in RAM, a reset could take hours of them with it.
+    timeseries_append(&logger_state->log, date_time.reg, &temperature_c);
+    timeseries_flush(&logger_state->log);
 }
 
 static void _thermistor_logging_face_update_display(thermistor_logger_state_t *logger_state, bool in_fahrenheit, bool clock_mode_24h, bool clock_24h_leading_zero) {
-    int8_t pos = (logger_state->data_points - 1 - logger_state->display_index) % THERMISTOR_LOGGING_NUM_DATA_POINTS;
+    int32_t pos = timeseries_count(&logger_state->log) - 1 - logger_state->display_index;
+    watch_date_time date_time;
+    float temperature_c;
     char buf[14];
     bool set_leading_zero = false;
 
@@ -49,10 +50,9 @@ static void _thermistor_logging_face_update_display(thermistor_logger_state_t *l
     watch_clear_indicator(WATCH_INDICATOR_PM);
     watch_clear_colon();
 
-    if (pos < 0) {
+    if (pos < 0 || timeseries_read(&logger_state->log, pos, 1, &date_time.reg, &temperature_c) != 1) {
         sprintf(buf, "TL%2dno dat", logger_state->display_index);
     } else if (logger_state->ts_ticks) {
-        watch_date_time date_time = logger_state->data[pos].timestamp;
         watch_set_colon();
         if (!clock_mode_24h) {
             if (date_time.unit.hour > 11) watch_set_indicator(WATCH_INDICATOR_PM);
@@ -66,9 +66,9 @@ static void _thermistor_logging_face_update_display(thermistor_logger_state_t *l
         sprintf(buf, "AT%2d%2d%02d%02d", date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
     } else {
         if (in_fahrenheit) {
-            sprintf(buf, "TL%2d%4.1f#F", logger_state->display_index, logger_state->data[pos].temperature_c * 1.8 + 32.0);
+            sprintf(buf, "TL%2d%4.1f#F", logger_state->display_index, temperature_c * 1.8 + 32.0);
         } else {
-            sprintf(buf, "TL%2d%4.1f#C", logger_state->display_index, logger_state->data[pos].temperature_c);
+            sprintf(buf, "TL%2d%4.1f#C", logger_state->display_index, temperature_c);
         }
     }
 
@@ -81,8 +81,10 @@ void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(thermistor_logger_state_t));
+        *context_ptr = movement_alloc_context(sizeof(thermistor_logger_state_t));
         memset(*context_ptr, 0, sizeof(thermistor_logger_state_t));
+        thermistor_logger_state_t *logger_state = (thermistor_logger_state_t *)*context_ptr;
+        timeseries_init(&logger_state->log, "templog", sizeof(float), THERMISTOR_LOGGING_READINGS_PER_FILE, THERMISTOR_LOGGING_NUM_FILES);
     }
 }
 
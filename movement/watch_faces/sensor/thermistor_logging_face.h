@@ -29,7 +29,8 @@
  * THERMISTOR LOGGING (aka Temperature Log)
  *
  * This watch face automatically logs the temperature once an hour, and
- * maintains a 36-hour log of readings. This watch face is admittedly rather
+ * maintains a log of at least 72 hours of readings on the filesystem, so
+ * the log survives a reset. This watch face is admittedly rather
  * complex, and bears some explanation.
  *
  * The main display shows the letters “TL” in the top left, indicating the
@@ -40,7 +41,7 @@
  *
  * A short press of the “Alarm” button advances to the next oldest reading;
  * you will see the number at the top right advance from 0 to 1 to 2, all
- * the way to 35, the oldest reading available.
+ * the way to 71, the oldest reading available.
  *
  * A short press of the “Light” button will briefly display the timestamp
  * of the reading. The letters at the top left will display the word “At”,
@@ -55,20 +56,20 @@
 
 #include "movement.h"
 #include "watch.h"
+#include "timeseries.h"
 
-#define THERMISTOR_LOGGING_NUM_DATA_POINTS (36)
-
-typedef struct {
-    watch_date_time timestamp;
-    float temperature_c;
-} thermistor_logger_data_point_t;
+// readings are logged to "templog.0" through "templog.3", a day to a file.
+#define THERMISTOR_LOGGING_READINGS_PER_FILE (24)
+#define THERMISTOR_LOGGING_NUM_FILES (4)
+// the number of readings you can page through; at least this many are always kept.
+#define THERMISTOR_LOGGING_NUM_DATA_POINTS (THERMISTOR_LOGGING_READINGS_PER_FILE * (THERMISTOR_LOGGING_NUM_FILES - 1))
 
 typedef struct {
     uint8_t display_index;  // the index we are displaying on screen
     uint8_t ts_ticks;       // when the user taps the LIGHT button, we show the timestamp for a few ticks.
-    int32_t data_points;    // the absolute number of data points logged
-    thermistor_logger_data_point_t data[THERMISTOR_LOGGING_NUM_DATA_POINTS];
+    timeseries_t log;       // temperatures in °C, as floats, timestamped with watch_date_time.reg
 } thermistor_logger_state_t;
+#define THERMISTOR_LOGGING_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(thermistor_logger_state_t))
 
 void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void thermistor_logging_face_activate(movement_settings_t *settings, void *context);
@@ -63,4 +63,6 @@ void thermistor_readout_face_resign(movement_settings_t *settings, void *context
     NULL, \
 })
 
+#define THERMISTOR_READOUT_FACE_CONTEXT_SIZE 0
+
 #endif // THERMISTOR_READOUT_FACE_H_
@@ -51,4 +51,6 @@ void thermistor_testing_face_resign(movement_settings_t *settings, void *context
     NULL, \
 })
 
+#define THERMISTOR_TESTING_FACE_CONTEXT_SIZE 0
+
 #endif // THERMISTOR_TESTING_FACE_H_
@@ -101,6 +101,7 @@ static void finetune_adjust_subseconds(int delta) {
     else
         total_adjustment += delta;
     finetune_update_display();
+    watch_display_commit();
 
     // Then delay clock
     watch_rtc_enable(false);
@@ -116,7 +117,7 @@ static void finetune_adjust_subseconds(int delta) {
                     date_time.unit.day++;
             }
         }
-        watch_rtc_set_date_time(date_time);
+        movement_set_date_time(date_time);
     }
     watch_rtc_enable(true);
 }
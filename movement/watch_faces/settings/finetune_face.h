@@ -73,5 +73,7 @@ void finetune_face_resign(movement_settings_t *settings, void *context);
     NULL, \
 })
 
+#define FINETUNE_FACE_CONTEXT_SIZE 0
+
 #endif // FINETUNE_FACE_H_
 
@@ -104,5 +104,7 @@ float nanosec_get_aging(void);
     nanosec_face_wants_background_task, \
 })
 
+#define NANOSEC_FACE_CONTEXT_SIZE 0
+
 #endif // NANOSEC_FACE_H_
 
@@ -44,7 +44,7 @@ const char preferences_face_titles[PREFERENCES_FACE_NUM_PREFERENCES][11] = {
 void preferences_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_alloc_context(sizeof(uint8_t));
 }
 
 void preferences_face_activate(movement_settings_t *settings, void *context) {
@@ -91,4 +91,6 @@ void preferences_face_resign(movement_settings_t *settings, void *context);
     NULL, \
 })
 
+#define PREFERENCES_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(uint8_t))
+
 #endif // PREFERENCES_FACE_H_
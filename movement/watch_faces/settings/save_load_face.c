@@ -28,22 +28,34 @@
 #include "filesystem.h"
 
 static void save(save_load_state_t *state) {
-    savefile_t savefile = {
-        1,
-        watch_get_backup_data(0),
-        watch_get_backup_data(1),
-        watch_get_backup_data(2),
-        watch_get_backup_data(3),
-        watch_get_backup_data(4),
-        watch_get_backup_data(5),
-        watch_get_backup_data(6),
-        watch_get_backup_data(7),
-        watch_rtc_get_date_time(),
-    };
-    state->slot[state->index] = savefile;
+    savefile_t savefile;
+    // zero the padding too, so that it compares equal to what's on file
+    memset(&savefile, 0, sizeof(savefile_t));
+    savefile.version = 1;
+    savefile.b0 = watch_get_backup_data(0);
+    savefile.b1 = watch_get_backup_data(1);
+    savefile.b2 = watch_get_backup_data(2);
+    savefile.b3 = watch_get_backup_data(3);
+    savefile.b4 = watch_get_backup_data(4);
+    savefile.b5 = watch_get_backup_data(5);
+    savefile.b6 = watch_get_backup_data(6);
+    savefile.b7 = watch_get_backup_data(7);
+    savefile.rtc = watch_rtc_get_date_time();
     char filename[23];
     sprintf(filename, "save_load_face_%d.bin", state->index);
-    filesystem_write_file(filename, (char*)&savefile, sizeof(savefile_t));
+    if (state->slot[state->index].version) {
+        // the slot is already on file, so only write the part of it that changed.
+        filesystem_dirty_range_t dirty = {0};
+        uint8_t *old_bytes = (uint8_t *)&state->slot[state->index];
+        uint8_t *new_bytes = (uint8_t *)&savefile;
+        for (uint8_t i = 0; i < sizeof(savefile_t); i++) {
+            if (old_bytes[i] != new_bytes[i]) filesystem_mark_dirty(&dirty, i, 1);
+        }
+        filesystem_write_dirty(filename, (char*)&savefile, &dirty);
+    } else {
+        filesystem_write_file(filename, (char*)&savefile, sizeof(savefile_t));
+    }
+    state->slot[state->index] = savefile;
 }
 
 static void load(save_load_state_t *state, movement_settings_t *settings) {
@@ -77,7 +89,7 @@ void save_load_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(save_load_state_t));
+        *context_ptr = movement_alloc_context(sizeof(save_load_state_t));
         memset(*context_ptr, 0, sizeof(save_load_state_t));
     }
 }
@@ -64,6 +64,7 @@ typedef struct {
     uint8_t update_timeout;
     savefile_t slot[SAVE_LOAD_SLOTS];
 } save_load_state_t;
+#define SAVE_LOAD_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(save_load_state_t))
 
 void save_load_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void save_load_face_activate(movement_settings_t *settings, void *context);
@@ -62,7 +62,7 @@ static void _handle_alarm_button(movement_settings_t *settings, watch_date_time
     }
     if (date_time.unit.day > days_in_month(date_time.unit.month, date_time.unit.year + WATCH_RTC_REFERENCE_YEAR))
         date_time.unit.day = 1;
-    watch_rtc_set_date_time(date_time);
+    movement_set_date_time(date_time);
 }
 
 static void _abort_quick_ticks() {
@@ -75,7 +75,7 @@ static void _abort_quick_ticks() {
 void set_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_alloc_context(sizeof(uint8_t));
 }
 
 void set_time_face_activate(movement_settings_t *settings, void *context) {
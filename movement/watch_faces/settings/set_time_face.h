@@ -57,4 +57,6 @@ void set_time_face_resign(movement_settings_t *settings, void *context);
     NULL, \
 })
 
+#define SET_TIME_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(uint8_t))
+
 #endif // SET_TIME_FACE_H_
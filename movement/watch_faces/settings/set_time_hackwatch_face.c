@@ -36,7 +36,7 @@ watch_date_time date_time_settings;
 void set_time_hackwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_alloc_context(sizeof(uint8_t));
 }
 
 void set_time_hackwatch_face_activate(movement_settings_t *settings, void *context) {
@@ -93,7 +93,7 @@ bool set_time_hackwatch_face_loop(movement_event_t event, movement_settings_t *s
                     }
                 }
                 date_time_settings.unit.second = 0;
-                watch_rtc_set_date_time(date_time_settings);
+                movement_set_date_time(date_time_settings);
             }
             break;
         case EVENT_ALARM_BUTTON_DOWN:
@@ -133,7 +133,7 @@ bool set_time_hackwatch_face_loop(movement_event_t event, movement_settings_t *s
                     break;
             }
             if (current_page != 2) // Do not set time when we are at seconds, it was already set previously
-                watch_rtc_set_date_time(date_time_settings);
+                movement_set_date_time(date_time_settings);
             break;
 
         case EVENT_ALARM_LONG_UP://Setting seconds on long release
@@ -174,7 +174,7 @@ bool set_time_hackwatch_face_loop(movement_event_t event, movement_settings_t *s
             if (date_time_settings.unit.day > days_in_month(date_time_settings.unit.month, date_time_settings.unit.year + WATCH_RTC_REFERENCE_YEAR))
                 date_time_settings.unit.day = 1;
             if (current_page != 2) // Do not set time when we are at seconds, it was already set previously
-                watch_rtc_set_date_time(date_time_settings);
+                movement_set_date_time(date_time_settings);
             //TODO: Do not update whole RTC, just what we are changing
             break;
         case EVENT_TIMEOUT:
@@ -63,4 +63,6 @@ void set_time_hackwatch_face_resign(movement_settings_t *settings, void *context
     NULL, \
 })
 
+#define SET_TIME_HACKWATCH_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(uint8_t))
+
 #endif // SET_TIME_HACKWATCH_FACE_H_
@@ -5,7 +5,6 @@
 #include "movement.h"
 #include "watch.h"
 #include "tally_face.h"
-#include <stdio.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -40,29 +39,14 @@ static void backup_write_u16(uint8_t lo_idx, uint8_t hi_idx, uint16_t v) {
     watch_store_backup_data(hi_idx, (uint8_t)((v >> 8) & 0xFF));
 }
 
-/* ----------------- state ----------------- */
-
-typedef struct {
-    uint16_t tally_a;
-    uint16_t tally_b;
-
-    uint8_t hold_sec_a;
-    uint8_t hold_sec_b;
-
-    bool light_held;
-    bool alarm_held;
-
-    bool action_done_a;
-    bool action_done_b;
-} tally_state_t;
-
 /* -------------- rendering helpers ------------- */
 
-static void render_top_line(tally_state_t *s, char *buf, size_t len) {
-    // A and B up to 3 digits each
-    snprintf(buf, len, "A:%03u B:%03u",
-             (unsigned)s->tally_a,
-             (unsigned)s->tally_b);
+static void render_top_line(tally_state_t *s) {
+    // A and B up to 3 digits each; the display runs out of positions after B's tens digit.
+    watch_display_string("A:", 0);
+    watch_display_uint(s->tally_a, 2, 3, WATCH_DISPLAY_PAD_ZERO);
+    watch_display_string(" B:", 5);
+    watch_display_uint(s->tally_b / 10, 8, 2, WATCH_DISPLAY_PAD_ZERO);
 }
 
 /* -------------- Movement face API ------------- */
@@ -72,7 +56,7 @@ void tally_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
     (void)watch_face_index;
 
     if (*context_ptr == NULL) {
-        tally_state_t *s = (tally_state_t *)watch_malloc(sizeof(tally_state_t));
+        tally_state_t *s = (tally_state_t *)movement_alloc_context(sizeof(tally_state_t));
         if (!s) return;
 
         s->tally_a = backup_read_u16(BK_TALLY_A_LO, BK_TALLY_A_HI);
@@ -177,10 +161,7 @@ bool tally_face_loop(movement_event_t event, movement_settings_t *settings, void
                 }
 
                 /* --- update display --- */
-                char top[16];
-                render_top_line(s, top, sizeof(top));
-                watch_display_string(top, 0); // top row
-                watch_display_time(settings->bit.clock_mode_24h);
+                render_top_line(s); // top row
             }
             break;
 
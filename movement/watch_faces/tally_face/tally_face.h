@@ -3,6 +3,21 @@
 
 #include "movement.h"
 
+typedef struct {
+    uint16_t tally_a;
+    uint16_t tally_b;
+
+    uint8_t hold_sec_a;
+    uint8_t hold_sec_b;
+
+    bool light_held;
+    bool alarm_held;
+
+    bool action_done_a;
+    bool action_done_b;
+} tally_state_t;
+#define GOAL_TRACKER_FACE_CONTEXT_SIZE MOVEMENT_CONTEXT_SIZE(sizeof(tally_state_t))
+
 /* Movement v2 watch face API */
 void tally_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void tally_face_activate(movement_settings_t *settings, void *context);
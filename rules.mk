@@ -8,7 +8,9 @@ SUBMODULES = tinyusb
 
 COBRA = cobra -f
 
-ifndef EMSCRIPTEN
+ifdef HOST
+all: $(BUILD)/$(BIN)
+else ifndef EMSCRIPTEN
 all: $(BUILD)/$(BIN).elf $(BUILD)/$(BIN).hex $(BUILD)/$(BIN).bin $(BUILD)/$(BIN).uf2 size
 else
 all: $(BUILD)/$(BIN).html
@@ -17,10 +19,14 @@ endif
 $(BUILD)/$(BIN).html: $(OBJS)
 	@echo HTML $@
 	@$(CC) $(LDFLAGS) $(OBJS) $(LIBS) -o $@ \
-		-s ASYNCIFY=1 \
-		-s EXPORTED_RUNTIME_METHODS=lengthBytesUTF8,printErr \
-		-s EXPORTED_FUNCTIONS=_main \
+		-s EXPORTED_RUNTIME_METHODS=lengthBytesUTF8,UTF8ToString,printErr \
+		-s EXPORTED_FUNCTIONS=_main,_watch_rtc_set_virtual_speed,_watch_rtc_get_virtual_time,_main_loop_end_trace \
 		--shell-file=$(TOP)/watch-library/simulator/shell.html
+	@echo WASM $(BUILD)/$(BIN).wasm: $$(wc -c < $(BUILD)/$(BIN).wasm) bytes
+
+$(BUILD)/$(BIN): $(OBJS)
+	@echo LD $@
+	@$(CC) $(LDFLAGS) $(OBJS) $(LIBS) -o $@
 
 $(BUILD)/$(BIN).elf: $(OBJS)
 	@echo LD $@
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Generates watch-library/shared/watch/watch_private_display_glyphs.h, the per-position glyph table that
+# watch_display_character renders from. For every position and every printable character, the table holds
+# the segments to light on each COM line, with all of the per-position character substitutions and the
+# extra segments (the descender on T, the funky ninth segment on B, D and @) already folded in.
+#
+# The segment layout and the character set are read from watch_private_display.h, so after changing either,
+# or the substitution rules below, run this script from anywhere and commit the regenerated header:
+#
+#   python3 utils/display_glyphs/generate_glyph_table.py
+
+import os
+import re
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+DISPLAY_HEADER = os.path.join(ROOT, "watch-library", "shared", "watch", "watch_private_display.h")
+OUTPUT = os.path.join(ROOT, "watch-library", "shared", "watch", "watch_private_display_glyphs.h")
+
+FIRST_GLYPH = 0x20
+NUM_GLYPHS = 0x7F - FIRST_GLYPH
+NUM_POSITIONS = 10
+NUM_COMS = 3
+
+
+def parse_display_header():
+    with open(DISPLAY_HEADER) as f:
+        source = f.read()
+    character_set = source.split("Character_Set[] =", 1)[1].split("};", 1)[0]
+    character_set = [int(bits, 2) for bits in re.findall(r"0b([01]{8})", character_set)]
+    segment_map = source.split("Segment_Map[] =", 1)[1].split("};", 1)[0]
+    segment_map = [int(word, 16) for word in re.findall(r"0x([0-9a-fA-F]+)", segment_map)]
+    assert len(character_set) == NUM_GLYPHS, "expected one Character_Set entry per printable character"
+    assert len(segment_map) == NUM_POSITIONS, "expected one Segment_Map entry per position"
+    return character_set, segment_map
+
+
+def substitute(character, position):
+    # the same substitutions watch_display_character used to make one character at a time.
+    c = chr(character)
+    if position == 4 or position == 6:
+        if c == '7': c = '&'  # "lowercase" 7
+        elif c == 'A': c = 'a'  # A needs to be lowercase
+        elif c == 'o': c = 'O'  # O needs to be uppercase
+        elif c == 'L': c = '!'  # L needs to be in top half
+        elif c in 'MmN': c = 'n'  # M and uppercase N need to be lowercase n
+        elif c == 'c': c = 'C'  # C needs to be uppercase
+        elif c == 'J': c = 'j'  # same
+        elif c in 'tT': c = '+'  # t in those locations looks like E otherwise
+        elif c in 'yY': c = '4'  # y in those locations looks like g otherwise
+        elif c in 'vVUWw': c = 'u'  # bottom segment duplicated, so show in top half
+    else:
+        if c == 'u': c = 'v'  # we can use the bottom segment; move to lower half
+        elif c == 'j': c = 'J'  # same but just display a normal J
+    if position > 1:
+        if c == 'T': c = 't'  # uppercase T only works in positions 0 and 1
+    if position == 1:
+        if c == 'a': c = 'A'  # A needs to be uppercase
+        elif c == 'o': c = 'O'  # O needs to be uppercase
+        elif c == 'i': c = 'l'  # I needs to be uppercase (use an l, it looks the same)
+        elif c == 'n': c = 'N'  # N needs to be uppercase
+        elif c == 'r': c = 'R'  # R needs to be uppercase
+        elif c == 'd': c = 'D'  # D needs to be uppercase
+        elif c in 'vVu': c = 'U'  # side segments shared, make uppercase
+        elif c == 'b': c = 'B'  # B needs to be uppercase
+        elif c == 'c': c = 'C'  # C needs to be uppercase
+    else:
+        if c == 'R': c = 'r'  # R needs to be lowercase almost everywhere
+    if position != 0:
+        if c == 'I': c = 'l'  # uppercase I only works in position 0
+    return ord(c)
+
+
+def render(character, position, character_set, segment_map):
+    # plays back the segment writes in the order the old renderer made them, so that where two segments of a
+    # position share a pin, the last write wins just as it did before. Returns {(com, seg): lit}.
+    pixels = {}
+    if position == 0:
+        pixels[(0, 15)] = False  # clear funky ninth segment
+    character = substitute(character, position)
+    segmap = segment_map[position]
+    segdata = character_set[character - FIRST_GLYPH]
+    for _ in range(8):
+        com = (segmap & 0xFF) >> 6
+        if com <= 2:
+            # COM3 means no segment exists.
+            pixels[(com, segmap & 0x3F)] = bool(segdata & 1)
+        segmap >>= 8
+        segdata >>= 1
+    c = chr(character)
+    if c == 'T' and position == 1:
+        pixels[(1, 12)] = True  # add descender
+    elif position == 0 and c in 'BD@':
+        pixels[(0, 15)] = True  # add funky ninth segment
+    elif position == 1 and c in 'BD@':
+        pixels[(0, 12)] = True  # add funky ninth segment
+    return pixels
+
+
+def main():
+    character_set, segment_map = parse_display_header()
+
+    shifts = []
+    masks = []
+    glyphs = []
+    for position in range(NUM_POSITIONS):
+        rendered = [render(FIRST_GLYPH + g, position, character_set, segment_map) for g in range(NUM_GLYPHS)]
+        touched = set(rendered[0])
+        # rendering is a masked store, so every character has to write the same segments of its position.
+        assert all(set(pixels) == touched for pixels in rendered), "position %d writes different segments per character" % position
+        shift = min(seg for _, seg in touched)
+        assert max(seg for _, seg in touched) - shift < 16, "a position's segments must fit in a 16-bit window"
+        shifts.append(shift)
+        mask = [0] * NUM_COMS
+        for com, seg in touched:
+            mask[com] |= 1 << (seg - shift)
+        masks.append(mask)
+        position_glyphs = []
+        for pixels in rendered:
+            lit = [0] * NUM_COMS
+            for (com, seg), on in pixels.items():
+                if on:
+                    lit[com] |= 1 << (seg - shift)
+            position_glyphs.append(lit)
+        glyphs.append(position_glyphs)
+
+    out = []
+    out.append("// Generated by utils/display_glyphs/generate_glyph_table.py from watch_private_display.h. Do not edit.")
+    out.append("#ifndef _WATCH_PRIVATE_DISPLAY_GLYPHS_H_INCLUDED")
+    out.append("#define _WATCH_PRIVATE_DISPLAY_GLYPHS_H_INCLUDED")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("#define GLYPH_TABLE_FIRST_CHARACTER 0x%02X" % FIRST_GLYPH)
+    out.append("#define GLYPH_TABLE_NUM_CHARACTERS %d" % NUM_GLYPHS)
+    out.append("")
+    out.append("// Every segment a position can touch sits within 16 pins of each other, so each position's segments")
+    out.append("// are stored as 16-bit masks relative to its lowest segment pin.")
+    out.append("static const uint8_t Glyph_Position_Shift[] = { %s };" % ", ".join(str(s) for s in shifts))
+    out.append("")
+    out.append("// The segments each position owns on COM0-2, relative to Glyph_Position_Shift.")
+    out.append("static const uint16_t Glyph_Position_Mask[][3] = {")
+    for position, mask in enumerate(masks):
+        out.append("    { 0x%04X, 0x%04X, 0x%04X }, // Position %d" % (mask[0], mask[1], mask[2], position))
+    out.append("};")
+    out.append("")
+    out.append("// The segments to light on COM0-2 for each position and character, relative to Glyph_Position_Shift.")
+    out.append("static const uint16_t Glyph_Table[][GLYPH_TABLE_NUM_CHARACTERS][3] = {")
+    for position, position_glyphs in enumerate(glyphs):
+        out.append("    { // Position %d" % position)
+        for g, lit in enumerate(position_glyphs):
+            c = chr(FIRST_GLYPH + g)
+            # a backslash at the end of a line comment would continue it onto the next line.
+            comment = {" ": "space", "\\": "backslash"}.get(c, c)
+            out.append("        { 0x%04X, 0x%04X, 0x%04X }, // %s" % (lit[0], lit[1], lit[2], comment))
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
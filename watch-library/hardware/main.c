@@ -79,10 +79,16 @@ int main(void) {
     while (1) {
         bool usb_enabled = hri_usbdevice_get_CTRLA_ENABLE_bit(USB);
         bool can_sleep = app_loop();
+        watch_display_commit();
         if (can_sleep && !usb_enabled) {
             app_prepare_for_standby();
+            _watch_perf_will_sleep();
             sleep(4);
+            _watch_perf_did_wake();
             app_wake_from_standby();
+        } else {
+            // we're staying awake; reading the perf counter keeps it from missing a SysTick wraparound.
+            watch_perf_get_us();
         }
     }
 
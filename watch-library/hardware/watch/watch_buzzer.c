@@ -176,6 +176,8 @@ void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
         watch_set_buzzer_period(NotePeriods[note]);
         watch_set_buzzer_on();
     }
+    // anything drawn before the note is meant to be seen while it plays.
+    watch_display_commit();
     delay_ms(duration_ms);
     watch_set_buzzer_off();
 }
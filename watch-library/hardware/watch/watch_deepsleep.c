@@ -152,6 +152,9 @@ static void _watch_disable_all_peripherals_except_slcd(void) {
 }
 
 void watch_enter_sleep_mode(void) {
+    // make sure the display shows whatever the app last drew; it won't get another chance until we wake.
+    watch_display_commit();
+
     // disable all other peripherals
     _watch_disable_all_peripherals_except_slcd();
 
@@ -170,7 +173,9 @@ void watch_enter_sleep_mode(void) {
     _watch_disable_all_pins_except_rtc();
 
     // enter standby (4); we basically hang out here until an interrupt wakes us.
+    _watch_perf_will_sleep();
     sleep(4);
+    _watch_perf_did_wake();
 
     // and we awake! re-enable the brownout detector and SysTick interrupt
     SUPC->INTENSET.bit.BOD33DET = 1;
@@ -185,6 +190,7 @@ void watch_enter_sleep_mode(void) {
 
 void watch_enter_deep_sleep_mode(void) {
     // identical to sleep mode except we disable the LCD first.
+    watch_display_commit();
     slcd_sync_deinit(&SEGMENT_LCD_0);
     hri_mclk_clear_APBCMASK_SLCD_bit(SLCD);
 
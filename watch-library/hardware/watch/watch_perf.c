@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_perf.h"
+#include "hpl_delay.h"
+
+// SysTick is a 24-bit down-counter clocked by the CPU, which delay_init sets free-running over its full range.
+// each reading adds the time that has passed since the last one, so it has to be read before the counter comes
+// all the way around: 4.2 seconds at 4 MHz, or half that at the 8 MHz we run at when plugged in to USB.
+// the cycles are turned into microseconds as they're added, at the clock rate of the moment, so that time counted
+// before the clock changes keeps the rate it was counted at.
+static uint64_t perf_us;
+static uint32_t perf_cycles;
+static uint32_t perf_last_systick;
+
+static uint32_t awake_since;
+static uint64_t awake_us;
+static uint32_t wakes;
+
+void _watch_perf_update(void) {
+    uint32_t now = SysTick->VAL;
+    // the CPU runs from OSC16M: at 8 MHz once _watch_enable_usb has bumped it up, and at 4 MHz otherwise.
+    uint8_t shift = hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL) == OSCCTRL_OSC16MCTRL_FSEL_8_Val ? 3 : 2;
+
+    // whatever doesn't make up a whole microsecond carries over to the next reading.
+    perf_cycles += (perf_last_systick - now) & SysTick_LOAD_RELOAD_Msk;
+    perf_last_systick = now;
+    perf_us += perf_cycles >> shift;
+    perf_cycles &= (1 << shift) - 1;
+}
+
+// the stock delay loop in hpl_systick.c counts the delay down by reloading SysTick, which would leave it
+// running over a much shorter range afterwards. the linker routes calls to it through here (see --wrap in make.mk),
+// so that the counter can be put back and the delay counted in its place.
+void __real__delay_cycles(void *const hw, uint32_t cycles);
+void __wrap__delay_cycles(void *const hw, uint32_t cycles);
+
+void __wrap__delay_cycles(void *const hw, uint32_t cycles) {
+    _watch_perf_update();
+    __real__delay_cycles(hw, cycles);
+
+    // writing VAL clears it, and the next tick reloads the full range.
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0;
+    perf_last_systick = SysTick->VAL;
+    perf_cycles += cycles;
+    _watch_perf_update();
+}
+
+uint32_t watch_perf_get_us(void) {
+    _watch_perf_update();
+
+    return (uint32_t)perf_us;
+}
+
+watch_perf_stats_t watch_perf_get_stats(void) {
+    watch_perf_stats_t stats;
+    stats.wakes = wakes;
+    stats.awake_us = awake_us + (uint32_t)(watch_perf_get_us() - awake_since);
+
+    return stats;
+}
+
+void watch_perf_reset_stats(void) {
+    wakes = 0;
+    awake_us = 0;
+    awake_since = watch_perf_get_us();
+}
+
+void _watch_perf_will_sleep(void) {
+    awake_us += (uint32_t)(watch_perf_get_us() - awake_since);
+}
+
+void _watch_perf_did_wake(void) {
+    wakes++;
+    awake_since = watch_perf_get_us();
+}
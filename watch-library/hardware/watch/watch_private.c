@@ -293,7 +293,8 @@ void _watch_enable_usb(void) {
     // disable USB, just in case.
     hri_usb_clear_CTRLA_ENABLE_bit(USB);
 
-    // bump clock up to 8 MHz
+    // count the time so far at 4 MHz, then bump clock up to 8 MHz
+    _watch_perf_update();
     hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_8_Val);
 
     // reset flags and disable DFLL
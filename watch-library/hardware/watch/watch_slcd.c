@@ -36,20 +36,34 @@ static void _sync_slcd(void) {
 void watch_enable_display(void) {
     SEGMENT_LCD_0_init();
     slcd_sync_enable(&SEGMENT_LCD_0);
+    // initializing the SLCD resets the segment data, so whatever we had committed is gone.
+    _watch_display_invalidate();
 }
 
-inline void watch_set_pixel(uint8_t com, uint8_t seg) {
-    slcd_sync_seg_on(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
-}
-
-inline void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    slcd_sync_seg_off(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
+void _watch_display_write_com(uint8_t com, uint32_t value) {
+    switch (com) {
+        case 0:
+            SLCD->SDATAL0.reg = value;
+            break;
+        case 1:
+            SLCD->SDATAL1.reg = value;
+            break;
+        case 2:
+            SLCD->SDATAL2.reg = value;
+            break;
+    }
 }
 
-void watch_clear_display(void) {
-    SLCD->SDATAL0.reg = 0;
-    SLCD->SDATAL1.reg = 0;
-    SLCD->SDATAL2.reg = 0;
+uint32_t _watch_display_read_com(uint8_t com) {
+    switch (com) {
+        case 0:
+            return SLCD->SDATAL0.reg;
+        case 1:
+            return SLCD->SDATAL1.reg;
+        case 2:
+            return SLCD->SDATAL2.reg;
+    }
+    return 0;
 }
 
 void watch_start_character_blink(char character, uint32_t duration) {
@@ -65,6 +79,7 @@ void watch_start_character_blink(char character, uint32_t duration) {
 
     watch_display_character(character, 7);
     watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    watch_display_commit();
 
     SLCD->CTRLD.bit.BLINK = 0;
     SLCD->CTRLA.bit.ENABLE = 0;
@@ -86,6 +101,7 @@ void watch_stop_blink(void) {
 
 void watch_start_tick_animation(uint32_t duration) {
     watch_display_character(' ', 8);
+    watch_display_commit();
     const uint32_t segs[] = { SLCD_SEGID(0, 2)};
     slcd_sync_start_animation(&SEGMENT_LCD_0, segs, 1, duration);
 }
@@ -98,4 +114,131 @@ void watch_stop_tick_animation(void) {
     const uint32_t segs[] = { SLCD_SEGID(0, 2)};
     slcd_sync_stop_animation(&SEGMENT_LCD_0, segs, 1);
     watch_display_character(' ', 8);
+    watch_display_commit();
+}
+
+// Sequences are stepped by DMA channel 0, which an event channel triggers from either the SLCD's frame counter 2
+// or the RTC alarm. Nothing else in the watch library uses the DMAC or the event system.
+#define SEQUENCE_DMA_CHANNEL 0
+#define SEQUENCE_EVENT_CHANNEL 0
+
+// One descriptor per step. Channel 0's first descriptor has to sit at the start of the descriptor section,
+// so the section simply is this list; the write-back section only needs room for channel 0, too.
+static DmacDescriptor sequence_descriptors[WATCH_DISPLAY_MAX_SEQUENCE_FRAMES] __attribute__((aligned(16)));
+static DmacDescriptor sequence_write_back __attribute__((aligned(16)));
+static bool sequence_every_minute;
+
+void _watch_display_start_sequence_clock(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration) {
+    bool every_minute = (duration == 0);
+    sequence_every_minute = every_minute;
+
+    // step n puts up frame n + 1. a looping sequence ends by putting frame 0 back up; a minute sequence just ends.
+    uint8_t num_steps = every_minute ? num_frames - 1 : num_frames;
+    for (uint8_t i = 0; i < num_steps; i++) {
+        DmacDescriptor *descriptor = &sequence_descriptors[i];
+        const watch_display_frame_t *frame = &frames[(i + 1) % num_frames];
+        bool last = (i == num_steps - 1);
+
+        // each step copies the frame's three words to SDATAL0-2, which sit eight bytes apart. with the addresses
+        // incrementing, the DMAC wants to be given the addresses just past the end of the block.
+        descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_WORD |
+                                 DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_DSTINC | DMAC_BTCTRL_STEPSEL_DST | DMAC_BTCTRL_STEPSIZE_X2 |
+                                 ((every_minute && last) ? DMAC_BTCTRL_BLOCKACT_INT : DMAC_BTCTRL_BLOCKACT_NOACT);
+        descriptor->BTCNT.reg = 3;
+        descriptor->SRCADDR.reg = (uint32_t)&frame->com[3];
+        descriptor->DSTADDR.reg = (uint32_t)&SLCD->SDATAL0.reg + 3 * 8;
+        if (!last) descriptor->DESCADDR.reg = (uint32_t)&sequence_descriptors[i + 1];
+        else descriptor->DESCADDR.reg = every_minute ? 0 : (uint32_t)&sequence_descriptors[0];
+    }
+
+    MCLK->AHBMASK.reg |= MCLK_AHBMASK_DMAC;
+    MCLK->APBCMASK.reg |= MCLK_APBCMASK_EVSYS;
+
+    // the descriptor sections can only be set up while the DMAC is disabled.
+    if (!DMAC->CTRL.bit.DMAENABLE) {
+        DMAC->BASEADDR.reg = (uint32_t)sequence_descriptors;
+        DMAC->WRBADDR.reg = (uint32_t)&sequence_write_back;
+        DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN0;
+    }
+
+    // one trigger, i.e. one event, moves a whole block: that is, one frame.
+    DMAC->CHID.reg = DMAC_CHID_ID(SEQUENCE_DMA_CHANNEL);
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_EVIE | DMAC_CHCTRLB_EVACT_TRIG | DMAC_CHCTRLB_TRIGACT_BLOCK | DMAC_CHCTRLB_TRIGSRC(0);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL;
+    if (every_minute) {
+        DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL;
+        NVIC_ClearPendingIRQ(DMAC_IRQn);
+        NVIC_EnableIRQ(DMAC_IRQn);
+    } else {
+        DMAC->CHINTENCLR.reg = DMAC_CHINTENCLR_TCMPL;
+    }
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_RUNSTDBY | DMAC_CHCTRLA_ENABLE;
+
+    if (every_minute) {
+        // the alarm matches at second 59 of every minute and fires as that second ends. we only want its event.
+        watch_rtc_disable_alarm_callback();
+        watch_date_time alarm_time = { .reg = 0 };
+        alarm_time.unit.second = 59;
+        RTC->MODE2.Mode2Alarm[0].ALARM.reg = alarm_time.reg;
+        RTC->MODE2.Mode2Alarm[0].MASK.reg = ALARM_MATCH_SS;
+        if (!RTC->MODE2.EVCTRL.bit.ALARMEO0) {
+            // EVCTRL is enable-protected. the RTC stops for a few cycles of its 32 kHz clock, once per power-up.
+            RTC->MODE2.CTRLA.bit.ENABLE = 0;
+            while (RTC->MODE2.SYNCBUSY.reg);
+            RTC->MODE2.EVCTRL.reg |= RTC_MODE2_EVCTRL_ALARMEO0;
+            RTC->MODE2.CTRLA.bit.ENABLE = 1;
+            while (RTC->MODE2.SYNCBUSY.reg);
+        }
+    } else {
+        SLCD->CTRLD.bit.FC2EN = 0;
+        _sync_slcd();
+        if (duration < SLCD_FC_MIN_MS) duration = SLCD_FC_MIN_MS;
+        if (duration > SLCD_FC_MAX_MS) duration = SLCD_FC_MAX_MS;
+        if (duration <= SLCD_FC_BYPASS_MAX_MS) {
+            SLCD->FC2.reg = SLCD_FC2_PB | ((duration / (1000 / SLCD_FRAME_FREQUENCY)) - 1);
+        } else {
+            SLCD->FC2.reg = (((duration / (1000 / SLCD_FRAME_FREQUENCY)) / 8 - 1));
+        }
+        if (!SLCD->EVCTRL.bit.FC2OEO) {
+            // EVCTRL is enable-protected too, and initializing the SLCD clears it.
+            SLCD->CTRLA.bit.ENABLE = 0;
+            _sync_slcd();
+            SLCD->EVCTRL.reg |= SLCD_EVCTRL_FC2OEO;
+            SLCD->CTRLA.bit.ENABLE = 1;
+            _sync_slcd();
+        }
+        SLCD->CTRLD.bit.FC2EN = 1;
+        _sync_slcd();
+    }
+
+    // the ALARM0 event comes out of the generator the RTC shares with COMP0 in the other modes.
+    EVSYS->USER[EVSYS_ID_USER_DMAC_CH_0].reg = EVSYS_USER_CHANNEL(SEQUENCE_EVENT_CHANNEL + 1);
+    EVSYS->CHANNEL[SEQUENCE_EVENT_CHANNEL].reg = EVSYS_CHANNEL_PATH_ASYNCHRONOUS |
+                                                 EVSYS_CHANNEL_EVGEN(every_minute ? EVSYS_ID_GEN_RTC_CMP_0 : EVSYS_ID_GEN_SLCD_FC2OVERFLOW);
+}
+
+void _watch_display_stop_sequence_clock(void) {
+    EVSYS->CHANNEL[SEQUENCE_EVENT_CHANNEL].reg = 0;
+    EVSYS->USER[EVSYS_ID_USER_DMAC_CH_0].reg = 0;
+
+    DMAC->CHID.reg = DMAC_CHID_ID(SEQUENCE_DMA_CHANNEL);
+    DMAC->CHCTRLA.reg &= ~DMAC_CHCTRLA_ENABLE;
+    while (DMAC->CHCTRLA.bit.ENABLE);
+    DMAC->CHINTENCLR.reg = DMAC_CHINTENCLR_TCMPL;
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL;
+
+    SLCD->CTRLD.bit.FC2EN = 0;
+    _sync_slcd();
+
+    // the alarm kept matching with its interrupt off; don't let that fire as soon as someone turns it back on.
+    if (sequence_every_minute) RTC->MODE2.INTFLAG.reg = RTC_MODE2_INTFLAG_ALARM0;
+}
+
+void DMAC_Handler(void) {
+    DMAC->CHID.reg = DMAC_CHID_ID(SEQUENCE_DMA_CHANNEL);
+    if (DMAC->CHINTFLAG.bit.TCMPL) {
+        // the last frame of a minute sequence is up, and the channel has disabled itself.
+        _watch_display_stop_sequence_clock();
+        _watch_display_sequence_did_finish();
+    }
 }
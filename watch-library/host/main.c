@@ -0,0 +1,1082 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// A headless runner for Movement and its watch faces. The firmware runs against a virtual RTC that
+// only advances when the firmware sleeps or blocks, so a day of watch time takes a fraction of a
+// second, or at a chosen multiple of real time with --speed. Button presses and shell commands can be
+// scripted; see print_usage below. A run can also be recorded as a trace of its input and every frame it
+// drew, and a trace replayed against a later build reports where the display and wake count differ.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <time.h>
+#include <math.h>
+// hal_sleep.h declares a sleep() of its own.
+#define sleep posix_sleep
+#include <unistd.h>
+#undef sleep
+#include "watch.h"
+#include "watch_host.h"
+#include "thermistor_driver.h"
+#include "filesystem.h"
+#include "timeseries.h"
+
+typedef enum {
+    INPUT_BUTTON_DOWN,
+    INPUT_BUTTON_UP,
+    INPUT_SHELL,
+    INPUT_TEMPERATURE,
+    INPUT_I2C,
+} input_action_t;
+
+typedef struct {
+    uint64_t counter;
+    input_action_t action;
+    uint8_t pin;
+    char *text;
+    float temperature;
+    uint8_t i2c_address;
+    uint8_t i2c_register;
+    uint8_t i2c_length;
+    uint8_t i2c_data[16];
+    size_t order;
+} input_event_t;
+
+typedef struct {
+    uint64_t counter;
+    uint32_t com[3];
+} trace_frame_t;
+
+static const struct {
+    const char *name;
+    uint8_t pin;
+} buttons[] = {
+    { "light", BTN_LIGHT },
+    { "mode", BTN_MODE },
+    { "alarm", BTN_ALARM },
+};
+
+watch_host_stats_t watch_host_stats;
+
+static uint64_t counter;
+static uint64_t end_counter;
+static uint64_t irq_total;
+static uint64_t last_serviced = UINT64_MAX;
+static uint32_t delay_remainder;
+
+static input_event_t *input_events;
+static size_t num_input_events;
+static size_t next_input_event;
+static int shell_pipe = -1;
+
+// the trace being recorded, if any.
+static FILE *trace_file;
+// the frames, start time and end of the trace being replayed, if any, and the frames drawn this time.
+static trace_frame_t *expected_frames;
+static size_t num_expected_frames;
+static trace_frame_t *drawn_frames;
+static size_t num_drawn_frames;
+static bool trace_has_start;
+static watch_date_time trace_start;
+static bool trace_has_end;
+static double trace_end_seconds;
+static uint64_t trace_wakes;
+
+static bool print_frames;
+static uint32_t last_frame[3] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+static const char *flash_image;
+static struct timespec wall_clock_start;
+// how many seconds of watch time pass per second of wall clock time; 0 runs as fast as possible.
+static double speed;
+
+uint64_t watch_host_get_counter(void) {
+    return counter;
+}
+
+void watch_host_count_irq(watch_host_irq_t irq) {
+    watch_host_stats.irqs[irq]++;
+    irq_total++;
+}
+
+static void _print_report(void) {
+    struct timespec wall_clock_end;
+    clock_gettime(CLOCK_MONOTONIC, &wall_clock_end);
+    double wall = (wall_clock_end.tv_sec - wall_clock_start.tv_sec) + (wall_clock_end.tv_nsec - wall_clock_start.tv_nsec) / 1e9;
+    double simulated = (double)counter / WATCH_HOST_COUNTS_PER_SECOND;
+    double hours = simulated / 3600.0;
+
+    printf("\n---\n");
+    printf("simulated:  %.3f s in %.3f s wall clock (%.0fx)\n", simulated, wall, wall > 0 ? simulated / wall : 0);
+    printf("app_loop:   %llu calls\n", (unsigned long long)watch_host_stats.app_loops);
+    printf("wakes:      %llu (%.1f per hour)\n", (unsigned long long)watch_host_stats.wakes, hours > 0 ? watch_host_stats.wakes / hours : 0);
+    printf("standby:    %.2f%% of the time\n", counter ? 100.0 * watch_host_stats.counts_asleep / counter : 0);
+    printf("interrupts: rtc periodic %llu, rtc alarm %llu, rtc tamper %llu, eic %llu, tc3 %llu, dmac %llu\n",
+           (unsigned long long)watch_host_stats.irqs[WATCH_HOST_IRQ_RTC_PERIODIC],
+           (unsigned long long)watch_host_stats.irqs[WATCH_HOST_IRQ_RTC_ALARM],
+           (unsigned long long)watch_host_stats.irqs[WATCH_HOST_IRQ_RTC_TAMPER],
+           (unsigned long long)watch_host_stats.irqs[WATCH_HOST_IRQ_EIC],
+           (unsigned long long)watch_host_stats.irqs[WATCH_HOST_IRQ_TC3],
+           (unsigned long long)watch_host_stats.irqs[WATCH_HOST_IRQ_DMAC]);
+    watch_display_stats_t display = watch_display_get_stats();
+    printf("display:    %lu characters drawn, %lu skipped, %lu SLCD register writes in %lu frames\n",
+           (unsigned long)display.characters_drawn, (unsigned long)display.characters_skipped,
+           (unsigned long)display.register_writes, (unsigned long)display.commits);
+    printf("periodic:  ");
+    for (int8_t per_n = 7; per_n >= 0; per_n--) {
+        printf(" %d Hz %llu%s", 128 >> per_n, (unsigned long long)watch_host_stats.periodic_irqs[per_n], per_n ? "," : "\n");
+    }
+}
+
+static void _format_frame(const uint32_t frame[3], char *buf, size_t size) {
+    char text[11];
+    _watch_host_get_display_text(frame, text);
+    snprintf(buf, size, "[%c%c %c%c %c%c%c%c%c %c%c]%s%s%s%s%s",
+             text[0], text[1], text[2], text[3], text[4], text[5],
+             (frame[1] & (1ul << 16)) ? ':' : ' ',
+             text[6], text[7], text[8], text[9],
+             (frame[0] & (1ul << 17)) ? " SIGNAL" : "",
+             (frame[0] & (1ul << 16)) ? " BELL" : "",
+             (frame[2] & (1ul << 17)) ? " PM" : "",
+             (frame[2] & (1ul << 16)) ? " 24H" : "",
+             (frame[1] & (1ul << 10)) ? " LAP" : "");
+}
+
+static void _note_frame_if_changed(void) {
+    uint32_t frame[3];
+    for (uint8_t com = 0; com < 3; com++) frame[com] = _watch_host_get_segment_data(com);
+    if (memcmp(frame, last_frame, sizeof(frame)) == 0) return;
+    memcpy(last_frame, frame, sizeof(frame));
+
+    char text[64];
+    _format_frame(frame, text, sizeof(text));
+    double seconds = (double)counter / WATCH_HOST_COUNTS_PER_SECOND;
+    if (print_frames) printf("%12.3f  %s\n", seconds, text);
+    if (trace_file != NULL) {
+        fprintf(trace_file, "%.4f frame %08x %08x %08x  # %s\n", seconds, frame[0], frame[1], frame[2], text);
+    }
+    if (num_expected_frames > 0) {
+        drawn_frames = realloc(drawn_frames, (num_drawn_frames + 1) * sizeof(trace_frame_t));
+        drawn_frames[num_drawn_frames].counter = counter;
+        memcpy(drawn_frames[num_drawn_frames].com, frame, sizeof(frame));
+        num_drawn_frames++;
+    }
+}
+
+static void _print_frame_difference(const trace_frame_t *expected, const trace_frame_t *drawn) {
+    char expected_text[64] = "nothing";
+    char drawn_text[64] = "nothing";
+    if (expected != NULL) _format_frame(expected->com, expected_text, sizeof(expected_text));
+    if (drawn != NULL) _format_frame(drawn->com, drawn_text, sizeof(drawn_text));
+    printf("            at %.4f the trace has %s", expected ? (double)expected->counter / WATCH_HOST_COUNTS_PER_SECOND : 0, expected_text);
+    if (drawn != NULL) printf(", but %.4f drew %s\n", (double)drawn->counter / WATCH_HOST_COUNTS_PER_SECOND, drawn_text);
+    else printf(", but nothing was drawn\n");
+}
+
+static bool _print_replay_report(void) {
+    if (num_expected_frames == 0 && !trace_has_end) return true;
+
+    // walk the two timelines in step; after the first difference, the rest is usually fallout from it, so
+    // only the first few are spelled out.
+    size_t identical = 0, retimed = 0, different = 0, shown = 0;
+    size_t count = num_expected_frames > num_drawn_frames ? num_expected_frames : num_drawn_frames;
+    for (size_t i = 0; i < count; i++) {
+        const trace_frame_t *expected = i < num_expected_frames ? &expected_frames[i] : NULL;
+        const trace_frame_t *drawn = i < num_drawn_frames ? &drawn_frames[i] : NULL;
+        if (expected && drawn && memcmp(expected->com, drawn->com, sizeof(expected->com)) == 0) {
+            if (expected->counter == drawn->counter) {
+                identical++;
+                continue;
+            }
+            retimed++;
+        } else {
+            different++;
+        }
+        if (shown++ < 5) _print_frame_difference(expected, drawn);
+    }
+    printf("replay:     %zu frames in the trace, %zu drawn: %zu identical, %zu at a different time, %zu different\n",
+           num_expected_frames, num_drawn_frames, identical, retimed, different);
+
+    bool more_wakes = false;
+    if (trace_has_end) {
+        long long delta = (long long)watch_host_stats.wakes - (long long)trace_wakes;
+        printf("            %llu wakes against %llu in the trace (%+lld)\n",
+               (unsigned long long)watch_host_stats.wakes, (unsigned long long)trace_wakes, delta);
+        more_wakes = delta > 0;
+    }
+
+    return retimed == 0 && different == 0 && !more_wakes;
+}
+
+static void _finish(void) {
+    fflush(stdout);
+    if (flash_image != NULL) {
+        // whatever the faces left in the write queue would be lost with RAM, but the watch has not reset.
+        filesystem_flush();
+        _watch_host_storage_save(flash_image);
+    }
+    if (trace_file != NULL) {
+        fprintf(trace_file, "%.4f end wakes %llu\n", (double)counter / WATCH_HOST_COUNTS_PER_SECOND,
+                (unsigned long long)watch_host_stats.wakes);
+        fclose(trace_file);
+    }
+    _print_report();
+    // a replay that drifted from its trace fails, so a trace can serve as a regression test.
+    exit(_print_replay_report() ? 0 : 1);
+}
+
+static void _advance_to(uint64_t next) {
+    if (speed > 0) {
+        // hold the virtual clock back until the wall clock catches up with it.
+        double due = (double)next / WATCH_HOST_COUNTS_PER_SECOND / speed;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        double elapsed = (now.tv_sec - wall_clock_start.tv_sec) + (now.tv_nsec - wall_clock_start.tv_nsec) / 1e9;
+        if (due > elapsed) {
+            struct timespec wait = { .tv_sec = (time_t)(due - elapsed) };
+            wait.tv_nsec = (long)((due - elapsed - wait.tv_sec) * 1e9);
+            nanosleep(&wait, NULL);
+        }
+    }
+    counter = next;
+}
+
+static uint64_t _next_event(void) {
+    uint64_t next = end_counter;
+    uint64_t candidate = _watch_rtc_next_event(counter);
+    if (candidate < next) next = candidate;
+    candidate = _watch_buzzer_next_event(counter);
+    if (candidate < next) next = candidate;
+    candidate = _watch_slcd_next_event(counter);
+    if (candidate < next) next = candidate;
+    if (next_input_event < num_input_events && input_events[next_input_event].counter < next) {
+        next = input_events[next_input_event].counter;
+    }
+    return next < counter ? counter : next;
+}
+
+static const char *_button_name(uint8_t pin) {
+    for (size_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); i++) {
+        if (buttons[i].pin == pin) return buttons[i].name;
+    }
+    return "?";
+}
+
+static uint16_t _thermistor_level(float temperature) {
+    // the inverse of watch_utility_thermistor_temperature, for the thermistor the driver expects.
+    double resistance = THERMISTOR_NOMINAL_RESISTANCE * exp(THERMISTOR_B_COEFFICIENT *
+        (1.0 / (temperature + 273.15) - 1.0 / (THERMISTOR_NOMINAL_TEMPERATURE + 273.15)));
+    double level;
+    if (THERMISTOR_HIGH_SIDE) level = 1023.0 * 64.0 * THERMISTOR_SERIES_RESISTANCE / (resistance + THERMISTOR_SERIES_RESISTANCE);
+    else level = 65535.0 / (THERMISTOR_SERIES_RESISTANCE / resistance + 1.0);
+    if (level < 0) level = 0;
+    if (level > UINT16_MAX) level = UINT16_MAX;
+    return (uint16_t)(level + 0.5);
+}
+
+static void _trace_input(const input_event_t *event) {
+    if (trace_file == NULL) return;
+    fprintf(trace_file, "%.4f ", (double)counter / WATCH_HOST_COUNTS_PER_SECOND);
+    switch (event->action) {
+        case INPUT_BUTTON_DOWN:
+            fprintf(trace_file, "down %s\n", _button_name(event->pin));
+            break;
+        case INPUT_BUTTON_UP:
+            fprintf(trace_file, "up %s\n", _button_name(event->pin));
+            break;
+        case INPUT_SHELL:
+            fprintf(trace_file, "shell %s\n", event->text);
+            break;
+        case INPUT_TEMPERATURE:
+            fprintf(trace_file, "temp %g\n", event->temperature);
+            break;
+        case INPUT_I2C:
+            fprintf(trace_file, "i2c 0x%02x 0x%02x", event->i2c_address, event->i2c_register);
+            for (uint8_t i = 0; i < event->i2c_length; i++) fprintf(trace_file, " %02x", event->i2c_data[i]);
+            fprintf(trace_file, "\n");
+            break;
+    }
+}
+
+static void _service_input(void) {
+    while (next_input_event < num_input_events && input_events[next_input_event].counter <= counter) {
+        input_event_t *event = &input_events[next_input_event++];
+        switch (event->action) {
+            case INPUT_BUTTON_DOWN:
+                _watch_host_set_button(event->pin, true);
+                break;
+            case INPUT_BUTTON_UP:
+                _watch_host_set_button(event->pin, false);
+                break;
+            case INPUT_SHELL:
+                if (shell_pipe >= 0) {
+                    if (write(shell_pipe, event->text, strlen(event->text)) < 0 || write(shell_pipe, "\n", 1) < 0) {
+                        perror("shell input");
+                    }
+                }
+                break;
+            case INPUT_TEMPERATURE:
+                _watch_host_set_analog_level(THERMISTOR_SENSE_PIN, _thermistor_level(event->temperature));
+                break;
+            case INPUT_I2C:
+                _watch_host_set_i2c_registers(event->i2c_address, event->i2c_register, event->i2c_data, event->i2c_length);
+                break;
+        }
+        _trace_input(event);
+    }
+}
+
+static void _service_interrupts(void) {
+    // scripted input can come due at a moment the peripherals were already serviced; don't fire them twice.
+    if (counter != last_serviced) {
+        last_serviced = counter;
+        // a display sequence changes the frame while the firmware sleeps.
+        bool sequence_was_running = watch_display_sequence_is_running();
+        _watch_rtc_service(counter);
+        _watch_buzzer_service(counter);
+        _watch_slcd_service(counter);
+        if (sequence_was_running) _note_frame_if_changed();
+    }
+    _service_input();
+}
+
+void watch_host_advance(uint64_t counts) {
+    uint64_t target = counter + counts;
+    while (true) {
+        uint64_t next = _next_event();
+        if (next > target) break;
+        _advance_to(next);
+        _service_interrupts();
+        if (counter >= end_counter) _finish();
+        if (next == target) return;
+    }
+    _advance_to(target);
+}
+
+static void _wait_for_interrupt(bool standby) {
+    uint64_t irqs_before = irq_total;
+    while (irq_total == irqs_before) {
+        if (counter >= end_counter) _finish();
+        uint64_t next = _next_event();
+        if (next == counter) {
+            // something is due right now; service it without moving time.
+            _service_interrupts();
+            continue;
+        }
+        if (standby) watch_host_stats.counts_asleep += next - counter;
+        _advance_to(next);
+        _service_interrupts();
+    }
+    if (standby) watch_host_stats.wakes++;
+}
+
+void watch_host_sleep(void) {
+    // sleep mode loops inside app_loop, so this is the only chance to see what it drew.
+    _note_frame_if_changed();
+    _watch_perf_will_sleep();
+    _wait_for_interrupt(true);
+    _watch_perf_did_wake();
+}
+
+static void _delay(uint64_t us) {
+    // convert to counts, carrying the remainder so that many short delays add up correctly.
+    uint64_t scaled = us * WATCH_HOST_COUNTS_PER_SECOND + delay_remainder;
+    delay_remainder = scaled % 1000000;
+    watch_host_advance(scaled / 1000000);
+}
+
+void delay_us(const uint16_t us) {
+    _delay(us);
+}
+
+void delay_ms(const uint16_t ms) {
+    _delay((uint64_t)ms * 1000);
+}
+
+static bool _parse_button(const char *name, uint8_t *pin) {
+    for (size_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); i++) {
+        if (!strcasecmp(name, buttons[i].name)) {
+            *pin = buttons[i].pin;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _parse_date_time(const char *string, watch_date_time *date_time) {
+    unsigned year, month, day, hour = 0, minute = 0, second = 0;
+    if (sscanf(string, "%u-%u-%u%*[ T]%u:%u:%u", &year, &month, &day, &hour, &minute, &second) < 3) return false;
+    if (year < WATCH_RTC_REFERENCE_YEAR || year > WATCH_RTC_REFERENCE_YEAR + 63) return false;
+    date_time->reg = 0;
+    date_time->unit.year = year - WATCH_RTC_REFERENCE_YEAR;
+    date_time->unit.month = month;
+    date_time->unit.day = day;
+    date_time->unit.hour = hour;
+    date_time->unit.minute = minute;
+    date_time->unit.second = second;
+    return true;
+}
+
+static input_event_t *_add_input_event(double seconds, input_action_t action, uint8_t pin, const char *text) {
+    input_events = realloc(input_events, (num_input_events + 1) * sizeof(input_event_t));
+    input_event_t *event = &input_events[num_input_events++];
+    event->counter = (uint64_t)(seconds * WATCH_HOST_COUNTS_PER_SECOND + 0.5);
+    event->action = action;
+    event->pin = pin;
+    event->text = text ? strdup(text) : NULL;
+    event->order = num_input_events;
+    return event;
+}
+
+static int _compare_input_events(const void *a, const void *b) {
+    const input_event_t *ea = a;
+    const input_event_t *eb = b;
+    if (ea->counter != eb->counter) return ea->counter < eb->counter ? -1 : 1;
+    // keep events that share a timestamp in file order.
+    return ea->order < eb->order ? -1 : 1;
+}
+
+static bool _load_input_script(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+
+    char line[256];
+    unsigned line_number = 0;
+    while (fgets(line, sizeof(line), f)) {
+        line_number++;
+        line[strcspn(line, "#\r\n")] = 0;
+
+        double seconds;
+        char action[16];
+        int consumed;
+        if (sscanf(line, " %15s %n", action, &consumed) == 1 && !strcmp(action, "start")) {
+            // a trace starts the clock where the recording did.
+            if (!_parse_date_time(line + consumed, &trace_start)) {
+                fprintf(stderr, "%s:%u: expected a start time\n", path, line_number);
+                fclose(f);
+                return false;
+            }
+            trace_has_start = true;
+            continue;
+        }
+        if (sscanf(line, " %lf %15s %n", &seconds, action, &consumed) < 2) continue;
+        char *rest = line + consumed;
+
+        uint8_t pin;
+        if (!strcmp(action, "shell")) {
+            _add_input_event(seconds, INPUT_SHELL, 0, rest);
+            continue;
+        }
+
+        if (!strcmp(action, "frame")) {
+            trace_frame_t frame;
+            frame.counter = (uint64_t)(seconds * WATCH_HOST_COUNTS_PER_SECOND + 0.5);
+            if (sscanf(rest, "%x %x %x", &frame.com[0], &frame.com[1], &frame.com[2]) != 3) {
+                fprintf(stderr, "%s:%u: expected three COM words\n", path, line_number);
+                fclose(f);
+                return false;
+            }
+            expected_frames = realloc(expected_frames, (num_expected_frames + 1) * sizeof(trace_frame_t));
+            expected_frames[num_expected_frames++] = frame;
+            continue;
+        }
+
+        if (!strcmp(action, "end")) {
+            unsigned long long wakes;
+            if (sscanf(rest, "wakes %llu", &wakes) == 1) trace_wakes = wakes;
+            trace_has_end = true;
+            trace_end_seconds = seconds;
+            continue;
+        }
+
+        if (!strcmp(action, "temp")) {
+            float temperature;
+            if (sscanf(rest, "%f", &temperature) != 1) {
+                fprintf(stderr, "%s:%u: expected a temperature in degrees Celsius\n", path, line_number);
+                fclose(f);
+                return false;
+            }
+            _add_input_event(seconds, INPUT_TEMPERATURE, 0, NULL)->temperature = temperature;
+            continue;
+        }
+
+        if (!strcmp(action, "i2c")) {
+            char *end;
+            unsigned long address = strtoul(rest, &end, 0);
+            unsigned long reg = strtoul(end, &end, 0);
+            uint8_t data[16];
+            uint8_t length = 0;
+            while (length < sizeof(data)) {
+                char *next;
+                unsigned long byte = strtoul(end, &next, 16);
+                if (next == end) break;
+                data[length++] = byte;
+                end = next;
+            }
+            if (address > 0x7F || reg > 0xFF || length == 0) {
+                fprintf(stderr, "%s:%u: expected an address, a register and up to 16 bytes\n", path, line_number);
+                fclose(f);
+                return false;
+            }
+            input_event_t *event = _add_input_event(seconds, INPUT_I2C, 0, NULL);
+            event->i2c_address = address;
+            event->i2c_register = reg;
+            event->i2c_length = length;
+            memcpy(event->i2c_data, data, length);
+            continue;
+        }
+
+        char button[16];
+        double held = 0.1;
+        if (sscanf(rest, "%15s %lf", button, &held) < 1 || !_parse_button(button, &pin)) {
+            fprintf(stderr, "%s:%u: expected light, mode or alarm\n", path, line_number);
+            fclose(f);
+            return false;
+        }
+
+        if (!strcmp(action, "down")) {
+            _add_input_event(seconds, INPUT_BUTTON_DOWN, pin, NULL);
+        } else if (!strcmp(action, "up")) {
+            _add_input_event(seconds, INPUT_BUTTON_UP, pin, NULL);
+        } else if (!strcmp(action, "press")) {
+            _add_input_event(seconds, INPUT_BUTTON_DOWN, pin, NULL);
+            _add_input_event(seconds + held, INPUT_BUTTON_UP, pin, NULL);
+        } else {
+            fprintf(stderr, "%s:%u: unknown action '%s'\n", path, line_number, action);
+            fclose(f);
+            return false;
+        }
+    }
+    fclose(f);
+
+    qsort(input_events, num_input_events, sizeof(input_event_t), _compare_input_events);
+    return true;
+}
+
+static void _benchmark_display(void) {
+    // every printable character in every position: frame n starts at character n and runs on from there.
+    enum { NUM_GLYPHS = 0x7F - 0x20, ITERATIONS = 20000 };
+    char frames[NUM_GLYPHS][11];
+    for (uint8_t n = 0; n < NUM_GLYPHS; n++) {
+        for (uint8_t i = 0; i < 10; i++) frames[n][i] = 0x20 + (n + i) % NUM_GLYPHS;
+        frames[n][10] = 0;
+    }
+
+    watch_enable_display();
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (uint8_t n = 0; n < NUM_GLYPHS; n++) {
+            watch_display_string(frames[n], 0);
+            watch_display_commit();
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    uint64_t characters = (uint64_t)ITERATIONS * NUM_GLYPHS * 10;
+    printf("watch_display_string: %llu characters in %.3f ms, %.1f ns per character\n",
+           (unsigned long long)characters, ns / 1e6, ns / characters);
+
+    // a day of clock faces, drawn the old way through sprintf and then with the integer formatting functions.
+    enum { SECONDS_PER_DAY = 86400, DAYS = 20 };
+    char buf[11];
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t day = 1; day <= DAYS; day++) {
+        for (uint32_t second = 0; second < SECONDS_PER_DAY; second++) {
+            sprintf(buf, "%2d%2d%02d%02d", (int)day, (int)(second / 3600), (int)(second / 60 % 60), (int)(second % 60));
+            watch_display_string(buf, 2);
+            watch_display_commit();
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double sprintf_ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t day = 1; day <= DAYS; day++) {
+        for (uint32_t second = 0; second < SECONDS_PER_DAY; second++) {
+            watch_display_uint(day, 2, 2, WATCH_DISPLAY_PAD_SPACE);
+            watch_display_time(second / 3600, second / 60 % 60, second % 60, false);
+            watch_display_commit();
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+
+    uint32_t clock_frames = SECONDS_PER_DAY * DAYS;
+    printf("clock face, sprintf:  %lu frames in %.3f ms, %.1f ns per frame\n", (unsigned long)clock_frames, sprintf_ns / 1e6, sprintf_ns / clock_frames);
+    printf("clock face, integers: %lu frames in %.3f ms, %.1f ns per frame\n", (unsigned long)clock_frames, ns / 1e6, ns / clock_frames);
+}
+
+// the filesystem only reaches the storage area through littlefs's block device callbacks. a littlefs that keeps
+// files somewhere else (e.g. a stand-in left where the submodule should be) moves no bytes, and timing it says
+// nothing about the flash, so the storage benchmarks check for this before reporting anything.
+static bool _storage_was_used(const watch_host_stats_t *before) {
+    return watch_host_stats.storage_reads != before->storage_reads ||
+           watch_host_stats.storage_writes != before->storage_writes ||
+           watch_host_stats.storage_erases != before->storage_erases;
+}
+
+static void _benchmark_line_reader(void) {
+    // a totp_uris.txt with 50 entries, read through line by line the way the TOTP face does on setup.
+    enum { NUM_ENTRIES = 50, ITERATIONS = 1000 };
+    char line[256];
+    watch_host_stats_t setup = watch_host_stats;
+    filesystem_write_file("totp_uris.txt", "", 0);
+    for (uint8_t i = 0; i < NUM_ENTRIES; i++) {
+        int length = sprintf(line, "otpauth://totp/Example%02u:alice@example.com?secret=JBSWY3DPEHPK3PXPJBSWY3DPEHPK3PX%c&issuer=Example%02u\n",
+                             i, 'A' + i % 26, i);
+        filesystem_append_file("totp_uris.txt", line, length);
+    }
+    filesystem_flush();
+    if (!_storage_was_used(&setup)) {
+        printf("filesystem: littlefs never touched the storage area; build against the littlefs submodule to measure it\n");
+        return;
+    }
+
+    struct timespec start, end;
+    watch_host_stats_t before = watch_host_stats;
+    uint32_t lines = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t iteration = 0; iteration < ITERATIONS; iteration++) {
+        int32_t offset = 0;
+        while (filesystem_read_line("totp_uris.txt", line, &offset, 255) && strlen(line)) lines++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("filesystem_read_line:     %lu lines in %.3f ms, %.1f ns per line, %.1f storage reads (%.0f bytes) per file\n",
+           (unsigned long)lines, ns / 1e6, ns / lines,
+           (double)(watch_host_stats.storage_reads - before.storage_reads) / ITERATIONS,
+           (double)(watch_host_stats.storage_bytes_read - before.storage_bytes_read) / ITERATIONS);
+
+    before = watch_host_stats;
+    lines = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t iteration = 0; iteration < ITERATIONS; iteration++) {
+        filesystem_line_reader_t reader;
+        if (!filesystem_open_line_reader(&reader, "totp_uris.txt")) break;
+        while (filesystem_read_next_line(&reader, line, 255) && strlen(line)) lines++;
+        filesystem_close_line_reader(&reader);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("filesystem_read_next_line: %lu lines in %.3f ms, %.1f ns per line, %.1f storage reads (%.0f bytes) per file\n",
+           (unsigned long)lines, ns / 1e6, ns / lines,
+           (double)(watch_host_stats.storage_reads - before.storage_reads) / ITERATIONS,
+           (double)(watch_host_stats.storage_bytes_read - before.storage_bytes_read) / ITERATIONS);
+}
+
+static void _benchmark_tempchart(void) {
+    struct timespec start, end;
+    double ns;
+    watch_host_stats_t before;
+
+    // a month of the temperature chart: one cell bumped every five minutes, saved once a day in full or in part.
+    enum { CHART_SIZE = 24 * 70 + 2, DAYS = 30 };
+    static uint8_t chart[CHART_SIZE];
+    filesystem_dirty_range_t dirty = {0};
+    memset(chart, 0, sizeof(chart));
+    before = watch_host_stats;
+    filesystem_write_file("tempchart.ini", (char *)chart, CHART_SIZE);
+    filesystem_flush();
+    if (!_storage_was_used(&before)) {
+        printf("tempchart: littlefs never touched the storage area; build against the littlefs submodule to measure it\n");
+        return;
+    }
+
+    for (uint8_t partial = 0; partial < 2; partial++) {
+        before = watch_host_stats;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t day = 0; day < DAYS; day++) {
+            for (uint32_t sample = 0; sample < 24 * 12; sample++) {
+                // temperatures wander a couple of degrees over the day
+                uint16_t cell = (sample / 12) + (20 + (sample / 36 + day) % 4) * 24;
+                chart[cell]++;
+                filesystem_mark_dirty(&dirty, cell, 1);
+            }
+            if (partial) filesystem_write_dirty("tempchart.ini", (char *)chart, &dirty);
+            else filesystem_write_file("tempchart.ini", (char *)chart, CHART_SIZE);
+            filesystem_flush();
+            dirty.start = dirty.end = 0;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+        printf("tempchart, %s: %.3f ms per save, %.0f bytes programmed and %.1f rows erased per save\n",
+               partial ? "changed cells" : "whole file   ", ns / 1e6 / DAYS,
+               (double)(watch_host_stats.storage_bytes_written - before.storage_bytes_written) / DAYS,
+               (double)(watch_host_stats.storage_erases - before.storage_erases) / DAYS);
+    }
+}
+
+typedef struct {
+    uint64_t ops;
+    watch_host_stats_t before;
+    uint64_t busy_ns, worst_ns, bytes_read, bytes_written, erases;
+} storage_workload_t;
+
+static void _storage_workload_begin(storage_workload_t *workload) {
+    workload->before = watch_host_stats;
+}
+
+static void _storage_workload_end(storage_workload_t *workload) {
+    uint64_t busy_ns = watch_host_stats.storage_busy_ns - workload->before.storage_busy_ns;
+    workload->ops++;
+    workload->busy_ns += busy_ns;
+    if (busy_ns > workload->worst_ns) workload->worst_ns = busy_ns;
+    workload->bytes_read += watch_host_stats.storage_bytes_read - workload->before.storage_bytes_read;
+    workload->bytes_written += watch_host_stats.storage_bytes_written - workload->before.storage_bytes_written;
+    workload->erases += watch_host_stats.storage_erases - workload->before.storage_erases;
+}
+
+static void _storage_workload_print(const char *name, storage_workload_t *workload) {
+    if (workload->ops == 0) return;
+    printf("  %-16s %8.2f ms mean, %8.2f ms worst, %7.0f bytes read, %6.0f programmed, %5.2f rows erased\n", name,
+           workload->busy_ns / 1e6 / workload->ops, workload->worst_ns / 1e6,
+           (double)workload->bytes_read / workload->ops, (double)workload->bytes_written / workload->ops,
+           (double)workload->erases / workload->ops);
+}
+
+// runs the flash model through one row by hand, without littlefs, and checks its books against the timings above.
+static bool _check_storage_model(void) {
+    enum { ROW = WATCH_HOST_STORAGE_ROWS - 1 };
+    uint8_t data[NVMCTRL_ROW_SIZE], readback[NVMCTRL_ROW_SIZE], straddle[10];
+    memset(data, 0xf0, sizeof(data));
+    memset(straddle, 0x0f, sizeof(straddle));
+    watch_host_stats_t before = watch_host_stats;
+
+    // erase the row, program all four pages, read them back, then program ten bytes that straddle two pages.
+    bool ok = watch_storage_erase(ROW) && watch_storage_write(ROW, 0, data, sizeof(data)) &&
+              watch_storage_read(ROW, 0, readback, sizeof(readback)) &&
+              watch_storage_write(ROW, NVMCTRL_PAGE_SIZE - 5, straddle, sizeof(straddle));
+    ok = ok && !memcmp(data, readback, sizeof(data));
+    // programming only clears bits, so 0x0f over 0xf0 leaves nothing set.
+    ok = ok && watch_storage_read(ROW, NVMCTRL_PAGE_SIZE - 5, readback, sizeof(straddle)) && readback[0] == 0 &&
+         readback[sizeof(straddle) - 1] == 0;
+    // and nothing past the end of the storage area is writable.
+    ok = ok && !watch_storage_write(WATCH_HOST_STORAGE_ROWS, 0, data, 1);
+
+    uint64_t expected_ns = WATCH_HOST_STORAGE_ROW_ERASE_US * 1000ULL + 6 * WATCH_HOST_STORAGE_PAGE_PROGRAM_US * 1000ULL +
+                           (NVMCTRL_ROW_SIZE + sizeof(straddle)) * WATCH_HOST_STORAGE_READ_NS_PER_BYTE;
+    uint64_t busy_ns = watch_host_stats.storage_busy_ns - before.storage_busy_ns;
+    uint64_t pages = watch_host_stats.storage_pages_programmed - before.storage_pages_programmed;
+    uint32_t erases = watch_host_stats.storage_row_erases[ROW] - before.storage_row_erases[ROW];
+    ok = ok && busy_ns == expected_ns && pages == 6 && erases == 1;
+    printf("flash model, one row by hand: %.3f ms (expected %.3f), %llu pages programmed, %lu erase: %s\n",
+           busy_ns / 1e6, expected_ns / 1e6, (unsigned long long)pages, (unsigned long)erases, ok ? "ok" : "WRONG");
+
+    return ok;
+}
+
+static void _benchmark_storage(uint32_t days) {
+    // each configuration changes one setting from the one in filesystem.c, which comes first.
+    static const struct {
+        const char *name;
+        lfs_size_t read_size, prog_size, lookahead_size;
+        int32_t block_cycles;
+    } configs[] = {
+        { "as shipped",        16, 64, 16, 100 },
+        { "read_size 64",      64, 64, 16, 100 },
+        { "read_size 4",        4, 64, 16, 100 },
+        { "prog_size 16",      16, 16, 16, 100 },
+        { "lookahead_size 8",  16, 64,  8, 100 },
+        { "block_cycles 500",  16, 64, 16, 500 },
+        { "block_cycles 16",   16, 64, 16,  16 },
+        { "no wear leveling",  16, 64, 16,  -1 },
+    };
+    // the activity face's log entry, and how it lays out its log.
+    typedef struct { uint16_t total_sec, pause_sec; uint8_t activity_type; } activity_record_t;
+    enum { TOTP_ENTRIES = 20, ACTIVITIES_PER_DAY = 4, CHART_SIZE = 24 * 70 + 2 };
+    static uint8_t chart[CHART_SIZE];
+    char line[256];
+
+    printf("flash time by the SAM L22's worst-case timings: %u us to program a page, %u us to erase a row\n",
+           WATCH_HOST_STORAGE_PAGE_PROGRAM_US, WATCH_HOST_STORAGE_ROW_ERASE_US);
+    if (!_check_storage_model()) return;
+    for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        printf("%s: read_size %lu, prog_size %lu, lookahead_size %lu, block_cycles %ld, %lu days\n", configs[c].name,
+               (unsigned long)configs[c].read_size, (unsigned long)configs[c].prog_size,
+               (unsigned long)configs[c].lookahead_size, (long)configs[c].block_cycles, (unsigned long)days);
+        if (!filesystem_init() || _filesystem_host_configure(configs[c].read_size, configs[c].prog_size,
+                                                             configs[c].lookahead_size, configs[c].block_cycles) < 0) {
+            printf("  couldn't format the storage area with this configuration\n");
+            continue;
+        }
+        watch_host_stats_t start = watch_host_stats;
+
+        // what's on the watch before the day starts: TOTP secrets, a blank chart, an empty activity log.
+        filesystem_write_file("totp_uris.txt", "", 0);
+        for (uint8_t i = 0; i < TOTP_ENTRIES; i++) {
+            int length = sprintf(line, "otpauth://totp/Example%02u:alice@example.com?secret=JBSWY3DPEHPK3PXPJBSWY3DPEHPK3PX%c&issuer=Example%02u\n",
+                                 i, 'A' + i % 26, i);
+            filesystem_append_file("totp_uris.txt", line, length);
+        }
+        memset(chart, 0, sizeof(chart));
+        filesystem_write_file("tempchart.ini", (char *)chart, CHART_SIZE);
+        filesystem_dirty_range_t dirty = {0};
+        timeseries_t activity_log;
+        timeseries_init(&activity_log, "activity", sizeof(activity_record_t), 28, 4);
+        filesystem_flush();
+
+        storage_workload_t totp = {0}, tempchart = {0}, activity = {0};
+        uint32_t timestamp = 0;
+        for (uint32_t day = 0; day < days; day++) {
+            // the TOTP face reads every secret when the watch boots; call it once a day.
+            _storage_workload_begin(&totp);
+            filesystem_line_reader_t reader;
+            if (filesystem_open_line_reader(&reader, "totp_uris.txt")) {
+                while (filesystem_read_next_line(&reader, line, 255) && strlen(line));
+                filesystem_close_line_reader(&reader);
+            }
+            _storage_workload_end(&totp);
+
+            for (uint32_t hour = 0; hour < 24; hour++) {
+                // the temperature chart's samples for the hour, written out at the end of it.
+                for (uint32_t sample = 0; sample < 12; sample++) {
+                    uint16_t cell = hour + (20 + (hour / 3 + day) % 4) * 24;
+                    chart[cell]++;
+                    filesystem_mark_dirty(&dirty, cell, 1);
+                }
+                _storage_workload_begin(&tempchart);
+                filesystem_write_dirty("tempchart.ini", (char *)chart, &dirty);
+                filesystem_flush();
+                _storage_workload_end(&tempchart);
+
+                // a few activities a day, each logged and flushed as it finishes.
+                if (hour % (24 / ACTIVITIES_PER_DAY) == 12 % (24 / ACTIVITIES_PER_DAY)) {
+                    activity_record_t record = { 1800 + day % 600, day % 60, day % 8 };
+                    _storage_workload_begin(&activity);
+                    timeseries_append(&activity_log, timestamp, &record);
+                    timeseries_flush(&activity_log);
+                    _storage_workload_end(&activity);
+                }
+                timestamp += 3600;
+            }
+        }
+
+        if (!_storage_was_used(&start)) {
+            printf("  littlefs never touched the storage area; build against the littlefs submodule to measure it\n");
+            continue;
+        }
+        _storage_workload_print("totp boot read", &totp);
+        _storage_workload_print("tempchart hour", &tempchart);
+        _storage_workload_print("activity append", &activity);
+
+        uint32_t most = 0, fewest = UINT32_MAX, total = 0, unused = 0;
+        for (uint32_t row = 0; row < WATCH_HOST_STORAGE_ROWS; row++) {
+            uint32_t erases = watch_host_stats.storage_row_erases[row] - start.storage_row_erases[row];
+            if (erases > most) most = erases;
+            if (erases < fewest) fewest = erases;
+            if (erases == 0) unused++;
+            total += erases;
+        }
+        printf("  %-16s %lu erases per row at most, %.1f on average, %lu at least; %lu of %u rows never erased\n", "wear",
+               (unsigned long)most, (double)total / WATCH_HOST_STORAGE_ROWS, (unsigned long)fewest,
+               (unsigned long)unused, WATCH_HOST_STORAGE_ROWS);
+    }
+}
+
+static void print_usage(const char *name) {
+    printf("usage: %s [options]\n"
+           "  -t, --time SECONDS     how much watch time to simulate (default 86400)\n"
+           "  -s, --start DATETIME   initial RTC value, as YYYY-MM-DD HH:MM:SS (default 2023-01-01 00:00:00)\n"
+           "  -i, --input FILE       replay button presses, sensor readings and shell commands from FILE; if FILE is\n"
+           "                         a trace, also check that the display and wake count match it\n"
+           "  -r, --record FILE      record the input and every frame drawn to a trace in FILE\n"
+           "  -d, --display          print the display every time it changes\n"
+           "  -u, --usb              act as if plugged into USB; the shell reads stdin\n"
+           "  -f, --flash FILE       load the storage area from FILE, and save it back on exit\n"
+           "  -x, --speed FACTOR     run FACTOR times faster than real time, e.g. 1, 60 or 3600 (default: as fast as possible)\n"
+           "  -b, --benchmark        time display drawing over the full character set, a clock face drawn with\n"
+           "                         and without sprintf, reading a 50-line file from the filesystem, and a month of\n"
+           "                         temperature chart saves, then exit\n"
+           "  -w, --wear DAYS        replay DAYS days of TOTP boot reads, hourly temperature chart updates and\n"
+           "                         activity log appends under several littlefs configurations, report flash time,\n"
+           "                         bytes moved and erases per row for each, then exit\n"
+           "\n"
+           "Each line of an input file is a time in seconds, an action and its arguments:\n"
+           "  12.5 press mode [HELD_SECONDS]\n"
+           "  20 down alarm\n"
+           "  22 up alarm\n"
+           "  30 shell ls\n"
+           "  40 temp 21.5\n"
+           "  50 i2c 0x18 0x28 00 04 00 00 00 40\n"
+           "\n"
+           "temp sets what the thermistor reads, in degrees Celsius. i2c fills in registers of the device at\n"
+           "an I2C address, e.g. an accelerometer's output registers. A trace adds a start line with the\n"
+           "initial RTC value, a frame line for every change to the display and an end line with the wake\n"
+           "count; replaying it runs to the same end, from the same start, unless -t or -s say otherwise.\n", name);
+}
+
+int main(int argc, char **argv) {
+    static const struct option options[] = {
+        { "time", required_argument, NULL, 't' },
+        { "start", required_argument, NULL, 's' },
+        { "input", required_argument, NULL, 'i' },
+        { "record", required_argument, NULL, 'r' },
+        { "display", no_argument, NULL, 'd' },
+        { "usb", no_argument, NULL, 'u' },
+        { "flash", required_argument, NULL, 'f' },
+        { "speed", required_argument, NULL, 'x' },
+        { "benchmark", no_argument, NULL, 'b' },
+        { "wear", required_argument, NULL, 'w' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    double seconds = 86400;
+    bool seconds_given = false;
+    bool start_given = false;
+    const char *record_path = NULL;
+    bool usb = false;
+    watch_date_time start_time = { .reg = 0 };
+    start_time.unit.year = 3;
+    start_time.unit.month = 1;
+    start_time.unit.day = 1;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "t:s:i:r:duf:x:bw:h", options, NULL)) != -1) {
+        switch (opt) {
+            case 't':
+                seconds = atof(optarg);
+                seconds_given = true;
+                break;
+            case 's':
+                if (!_parse_date_time(optarg, &start_time)) {
+                    fprintf(stderr, "invalid start time '%s'\n", optarg);
+                    return 1;
+                }
+                start_given = true;
+                break;
+            case 'i':
+                if (!_load_input_script(optarg)) return 1;
+                break;
+            case 'r':
+                record_path = optarg;
+                break;
+            case 'd':
+                print_frames = true;
+                break;
+            case 'u':
+                usb = true;
+                break;
+            case 'f':
+                flash_image = optarg;
+                break;
+            case 'x':
+                speed = atof(optarg);
+                if (speed < 0) {
+                    fprintf(stderr, "invalid speed '%s'\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'b':
+                _benchmark_display();
+                if (filesystem_init()) {
+                    _benchmark_line_reader();
+                    _benchmark_tempchart();
+                } else {
+                    printf("filesystem: couldn't mount the storage area\n");
+                }
+                return 0;
+            case 'w':
+                _benchmark_storage(atoi(optarg));
+                return 0;
+            default:
+                print_usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (trace_has_end && !seconds_given) seconds = trace_end_seconds;
+    if (trace_has_start && !start_given) start_time = trace_start;
+    end_counter = (uint64_t)(seconds * WATCH_HOST_COUNTS_PER_SECOND);
+
+    if (record_path != NULL) {
+        trace_file = fopen(record_path, "w");
+        if (trace_file == NULL) {
+            perror(record_path);
+            return 1;
+        }
+        fprintf(trace_file, "# Sensor Watch trace: replay with --input to compare a build against it.\n");
+        fprintf(trace_file, "start %04u-%02u-%02u %02u:%02u:%02u\n", start_time.unit.year + WATCH_RTC_REFERENCE_YEAR,
+                start_time.unit.month, start_time.unit.day, start_time.unit.hour, start_time.unit.minute, start_time.unit.second);
+    }
+
+    if (usb) {
+        // scripted shell commands are fed to the firmware through a pipe standing in for stdin.
+        for (size_t i = 0; i < num_input_events; i++) {
+            if (input_events[i].action == INPUT_SHELL) {
+                int fds[2];
+                if (pipe(fds) == 0) {
+                    dup2(fds[0], STDIN_FILENO);
+                    close(fds[0]);
+                    shell_pipe = fds[1];
+                }
+                break;
+            }
+        }
+        fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+        _watch_enable_usb();
+    }
+    if (flash_image != NULL) _watch_host_storage_load(flash_image);
+    clock_gettime(CLOCK_MONOTONIC, &wall_clock_start);
+
+    // User code. Give the app a chance to initialize its data structures and state.
+    app_init();
+
+    // Watch library code. Set initial parameters for the device and enable the RTC.
+    _watch_init();
+    watch_rtc_set_date_time(start_time);
+
+    // User code. Give the app a chance to enable and set up peripherals.
+    app_setup();
+
+    bool can_sleep = true;
+    while (true) {
+        // a non-blocking read that comes up empty leaves stdin in an error state; clear it so the shell can try again.
+        if (usb) clearerr(stdin);
+
+        bool could_sleep = can_sleep;
+        can_sleep = app_loop();
+        watch_display_commit();
+        watch_host_stats.app_loops++;
+        _note_frame_if_changed();
+
+        if (can_sleep) {
+            app_prepare_for_standby();
+            watch_host_sleep();
+            app_wake_from_standby();
+        } else if (!could_sleep) {
+            // on hardware the CPU would keep calling app_loop, but nothing it looks at changes without an
+            // interrupt. after one extra pass to let the app settle, skip ahead to the next interrupt.
+            _wait_for_interrupt(false);
+        }
+    }
+
+    return 0;
+}
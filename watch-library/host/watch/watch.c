@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch.h"
+#include "watch_host.h"
+
+bool _watch_host_usb_enabled = false;
+
+bool watch_is_buzzer_or_led_enabled(void) {
+    // firmware may spin on this while a buzzer sequence plays out; let a little virtual time pass
+    // on each poll so the TC3 interrupt that ends the sequence has a chance to fire.
+    if (_watch_tcc_is_enabled()) {
+        watch_host_advance(1);
+        return true;
+    }
+    return false;
+}
+
+bool watch_is_usb_enabled(void) {
+    return _watch_host_usb_enabled;
+}
+
+void watch_reset_to_bootloader(void) {
+    // No bootloader on the host; nothing to do here
+}
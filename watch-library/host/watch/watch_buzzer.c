@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_buzzer.h"
+#include "watch_private_buzzer.h"
+#include "watch_host.h"
+
+// TC3 drives the sequencer at 64 Hz, i.e. every 16 counts of the virtual clock.
+#define TC3_PERIOD (WATCH_HOST_COUNTS_PER_SECOND / 64)
+
+static bool buzzer_enabled = false;
+static bool buzzer_on = false;
+static uint32_t buzzer_period;
+
+void cb_watch_buzzer_seq(void);
+
+static uint16_t _seq_position;
+static int8_t _tone_ticks, _repeat_counter;
+static bool _callback_running = false;
+static uint64_t _tc3_next;
+static int8_t *_sequence;
+static void (*_cb_finished)(void);
+
+static inline void _tc3_start(void) {
+    _tc3_next = watch_host_get_counter() + TC3_PERIOD;
+    _callback_running = true;
+}
+
+static inline void _tc3_stop(void) {
+    _callback_running = false;
+}
+
+void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
+    if (_callback_running) _tc3_stop();
+    watch_set_buzzer_off();
+    _sequence = note_sequence;
+    _cb_finished = callback_on_end;
+    _seq_position = 0;
+    _tone_ticks = 0;
+    _repeat_counter = -1;
+    // prepare buzzer
+    watch_enable_buzzer();
+    // start the timer (for the 64 hz callback)
+    _tc3_start();
+}
+
+void cb_watch_buzzer_seq(void) {
+    // callback for reading the note sequence
+    if (_tone_ticks == 0) {
+        if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
+            // repeat indicator found
+            if (_repeat_counter == -1) {
+                // first encounter: load repeat counter
+                _repeat_counter = _sequence[_seq_position + 1];
+            } else _repeat_counter--;
+            if (_repeat_counter > 0)
+                // rewind
+                if (_seq_position > _sequence[_seq_position] * -2)
+                    _seq_position += _sequence[_seq_position] * 2;
+                else
+                    _seq_position = 0;
+            else {
+                // continue
+                _seq_position += 2;
+                _repeat_counter = -1;
+            }
+        }
+        if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
+            // read note
+            BuzzerNote note = _sequence[_seq_position];
+            if (note != BUZZER_NOTE_REST) {
+                watch_set_buzzer_period(NotePeriods[note]);
+                watch_set_buzzer_on();
+            } else watch_set_buzzer_off();
+            // set duration ticks and move to next tone
+            _tone_ticks = _sequence[_seq_position + 1];
+            _seq_position += 2;
+        } else {
+            // end the sequence
+            watch_buzzer_abort_sequence();
+            if (_cb_finished) _cb_finished();
+        }
+    } else _tone_ticks--;
+}
+
+void watch_buzzer_abort_sequence(void) {
+    // ends/aborts the sequence
+    if (_callback_running) _tc3_stop();
+    watch_set_buzzer_off();
+}
+
+uint64_t _watch_buzzer_next_event(uint64_t now) {
+    (void) now;
+    return _callback_running ? _tc3_next : WATCH_HOST_NO_EVENT;
+}
+
+void _watch_buzzer_service(uint64_t now) {
+    if (_callback_running && now >= _tc3_next) {
+        _tc3_next += TC3_PERIOD;
+        watch_host_count_irq(WATCH_HOST_IRQ_TC3);
+        cb_watch_buzzer_seq();
+    }
+}
+
+void watch_enable_buzzer(void) {
+    _watch_enable_tcc();
+    buzzer_enabled = true;
+    buzzer_period = NotePeriods[BUZZER_NOTE_A4];
+}
+
+void watch_set_buzzer_period(uint32_t period) {
+    if (!buzzer_enabled) return;
+    buzzer_period = period;
+}
+
+void watch_disable_buzzer(void) {
+    buzzer_enabled = false;
+    buzzer_on = false;
+    _watch_disable_tcc();
+}
+
+void watch_set_buzzer_on(void) {
+    if (!buzzer_enabled) return;
+    buzzer_on = true;
+}
+
+void watch_set_buzzer_off(void) {
+    buzzer_on = false;
+}
+
+void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
+    if (note == BUZZER_NOTE_REST) {
+        watch_set_buzzer_off();
+    } else {
+        watch_set_buzzer_period(NotePeriods[note]);
+        watch_set_buzzer_on();
+    }
+    // anything drawn before the note is meant to be seen while it plays.
+    watch_display_commit();
+    delay_ms(duration_ms);
+    watch_set_buzzer_off();
+}
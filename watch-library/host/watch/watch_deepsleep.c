@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_extint.h"
+#include "watch_host.h"
+
+static uint32_t watch_backup_data[8];
+static bool btn_alarm_extwake_enabled;
+static bool btn_alarm_extwake_level;
+
+void watch_register_extwake_callback(uint8_t pin, ext_irq_cb_t callback, bool level) {
+    if (pin == BTN_ALARM) {
+        btn_alarm_callback = callback;
+        btn_alarm_extwake_enabled = true;
+        btn_alarm_extwake_level = level;
+    }
+}
+
+void watch_disable_extwake_interrupt(uint8_t pin) {
+    if (pin == BTN_ALARM) {
+        btn_alarm_callback = NULL;
+        btn_alarm_extwake_enabled = false;
+    }
+}
+
+void _watch_rtc_tamper_input(uint8_t pin, bool level) {
+    if (pin == BTN_ALARM && btn_alarm_extwake_enabled && level == btn_alarm_extwake_level) {
+        watch_host_count_irq(WATCH_HOST_IRQ_RTC_TAMPER);
+        if (btn_alarm_callback != NULL) btn_alarm_callback();
+    }
+}
+
+void watch_store_backup_data(uint32_t data, uint8_t reg) {
+    if (reg < 8) {
+        watch_backup_data[reg] = data;
+    }
+}
+
+uint32_t watch_get_backup_data(uint8_t reg) {
+    if (reg < 8) {
+        return watch_backup_data[reg];
+    }
+
+    return 0;
+}
+
+void watch_enter_sleep_mode(void) {
+    // make sure the display shows whatever the app last drew; it won't get another chance until we wake.
+    watch_display_commit();
+
+    // disable all other peripherals, and the tick interrupt
+    _watch_disable_tcc();
+    watch_disable_external_interrupts();
+    watch_rtc_disable_all_periodic_callbacks();
+
+    // enter standby (4); we basically hang out here until an interrupt wakes us.
+    watch_host_sleep();
+
+    // call app_setup so the app can re-enable everything we disabled.
+    app_setup();
+
+    // and call app_wake_from_standby (since main won't have a chance to do it)
+    app_wake_from_standby();
+}
+
+void watch_enter_deep_sleep_mode(void) {
+    // identical to sleep mode except we disable the LCD first.
+    watch_clear_display();
+
+    watch_enter_sleep_mode();
+}
+
+void watch_enter_backup_mode(void) {
+    // BACKUP mode ends in a reset, which the host build does not model; sleep until something wakes us.
+    watch_rtc_disable_all_periodic_callbacks();
+    watch_disable_external_interrupts();
+    watch_clear_display();
+    watch_host_sleep();
+}
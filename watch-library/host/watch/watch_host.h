@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_HOST_H_INCLUDED
+#define _WATCH_HOST_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The host build runs on a virtual clock: time only moves when the runner in main.c advances it,
+// either to the next pending interrupt while the firmware sleeps, or through a blocking delay_ms.
+// The unit is one tick of a 1024 Hz counter, the same rate the RTC prescaler runs at on the SAM L22.
+#define WATCH_HOST_COUNTS_PER_SECOND 1024
+#define WATCH_HOST_NO_EVENT UINT64_MAX
+
+// The RWWEE storage area is 32 rows of four pages. Programming a page and erasing a row take the SAM L22's
+// worst-case times from the datasheet's NVM characteristics; reads are memory-mapped, so they cost about as
+// long as the CPU takes to copy the bytes out at 4 MHz.
+#define WATCH_HOST_STORAGE_ROWS 32
+#define WATCH_HOST_STORAGE_PAGE_PROGRAM_US 2500
+#define WATCH_HOST_STORAGE_ROW_ERASE_US 6000
+#define WATCH_HOST_STORAGE_READ_NS_PER_BYTE 750
+
+typedef enum {
+    WATCH_HOST_IRQ_RTC_PERIODIC = 0,
+    WATCH_HOST_IRQ_RTC_ALARM,
+    WATCH_HOST_IRQ_RTC_TAMPER,
+    WATCH_HOST_IRQ_EIC,
+    WATCH_HOST_IRQ_TC3,
+    WATCH_HOST_IRQ_DMAC,
+    WATCH_HOST_NUM_IRQS
+} watch_host_irq_t;
+
+typedef struct {
+    uint64_t app_loops;             // calls to app_loop
+    uint64_t wakes;                 // times the CPU left STANDBY
+    uint64_t counts_asleep;         // virtual time spent in STANDBY
+    uint64_t irqs[WATCH_HOST_NUM_IRQS];
+    uint64_t periodic_irqs[8];      // RTC periodic interrupts by PERn (PER0 is 128 Hz, PER7 is 1 Hz)
+    uint64_t storage_reads;         // calls to watch_storage_read
+    uint64_t storage_bytes_read;    // bytes read from the RWWEE storage area
+    uint64_t storage_writes;        // calls to watch_storage_write
+    uint64_t storage_bytes_written; // bytes programmed into the RWWEE storage area
+    uint64_t storage_pages_programmed;
+    uint64_t storage_erases;        // rows erased
+    uint64_t storage_busy_ns;       // time spent reading, programming and erasing, by the timings above
+    uint32_t storage_row_erases[WATCH_HOST_STORAGE_ROWS];
+} watch_host_stats_t;
+
+extern watch_host_stats_t watch_host_stats;
+
+/// Returns the current value of the virtual counter.
+uint64_t watch_host_get_counter(void);
+
+/// Busy-waits for the given number of counts. Interrupts that come due along the way are serviced.
+void watch_host_advance(uint64_t counts);
+
+/// Enters STANDBY until the next interrupt fires.
+void watch_host_sleep(void);
+
+/// Records that an interrupt was raised; the runner uses this to count wakes.
+void watch_host_count_irq(watch_host_irq_t irq);
+
+// Peripheral hooks for the runner. Each *_next_event function returns the counter value of the next
+// moment the peripheral needs servicing (or WATCH_HOST_NO_EVENT), and each *_service function raises
+// whatever interrupts are due at the current counter value.
+uint64_t _watch_rtc_next_event(uint64_t now);
+void _watch_rtc_service(uint64_t now);
+uint64_t _watch_buzzer_next_event(uint64_t now);
+void _watch_buzzer_service(uint64_t now);
+uint64_t _watch_slcd_next_event(uint64_t now);
+void _watch_slcd_service(uint64_t now);
+
+/// Returns true if the TCC (which drives the buzzer and LED) is enabled.
+bool _watch_tcc_is_enabled(void);
+
+/// Feeds a pin level to the RTC's tamper (extwake) detector.
+void _watch_rtc_tamper_input(uint8_t pin, bool level);
+
+/// Drives a button pin as if the wearer pressed (true) or released (false) it.
+void _watch_host_set_button(uint8_t pin, bool level);
+
+/// Returns the raw COM0-COM2 segment data, as it would appear in the SLCD's SDATAL0-2 registers.
+uint32_t _watch_host_get_segment_data(uint8_t com);
+
+/// Loads or saves the RWWEE storage area from an image file, so a filesystem can persist between runs.
+bool _watch_host_storage_load(const char *path);
+bool _watch_host_storage_save(const char *path);
+
+/** @brief Renders a frame of segment data as text.
+  * @param frame the COM0-COM2 segment data, as returned by _watch_host_get_segment_data.
+  * @param buf a buffer of at least 11 bytes. Characters that don't match a glyph are rendered as '?'.
+  */
+void _watch_host_get_display_text(const uint32_t frame[3], char *buf);
+
+/// Sets the level an analog pin reads, as returned by watch_get_analog_pin_level.
+void _watch_host_set_analog_level(uint8_t pin, uint16_t level);
+
+/// Fills in registers of the I2C device at a 7-bit address, e.g. to feed readings to an accelerometer driver.
+void _watch_host_set_i2c_registers(uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t length);
+
+#endif
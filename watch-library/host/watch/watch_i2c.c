@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_i2c.h"
+#include "watch_host.h"
+
+// every 7-bit address is backed by a 256-byte register file, which the runner can fill in to stand in for a
+// sensor. like most I2C sensors, the first byte of a write sets the register pointer, and reads and writes
+// continue from there, one register per byte.
+static uint8_t registers[128][256];
+static uint8_t register_pointer[128];
+
+void _watch_host_set_i2c_registers(uint8_t addr, uint8_t reg, const uint8_t *data, uint8_t length) {
+    for (uint8_t i = 0; i < length; i++) registers[addr & 0x7F][(uint8_t)(reg + i)] = data[i];
+}
+
+void watch_enable_i2c(void) {}
+
+void watch_disable_i2c(void) {}
+
+void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
+    if (length == 0) return;
+    addr &= 0x7F;
+    register_pointer[addr] = buf[0];
+    for (uint16_t i = 1; i < length; i++) registers[addr][register_pointer[addr]++] = buf[i];
+}
+
+void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
+    addr &= 0x7F;
+    for (uint16_t i = 0; i < length; i++) buf[i] = registers[addr][register_pointer[addr]++];
+}
+
+void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {
+    uint8_t buf[2] = { reg, data };
+    watch_i2c_send(addr, buf, 2);
+}
+
+uint8_t watch_i2c_read8(int16_t addr, uint8_t reg) {
+    uint8_t data;
+    watch_i2c_send(addr, &reg, 1);
+    watch_i2c_receive(addr, &data, 1);
+    return data;
+}
+
+uint16_t watch_i2c_read16(int16_t addr, uint8_t reg) {
+    uint16_t data;
+    watch_i2c_send(addr, &reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 2);
+    return data;
+}
+
+uint32_t watch_i2c_read24(int16_t addr, uint8_t reg) {
+    uint32_t data = 0;
+    watch_i2c_send(addr, &reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 3);
+    return data << 8;
+}
+
+uint32_t watch_i2c_read32(int16_t addr, uint8_t reg) {
+    uint32_t data;
+    watch_i2c_send(addr, &reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 4);
+    return data;
+}
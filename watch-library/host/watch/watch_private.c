@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_private.h"
+#include "watch_host.h"
+
+static bool tcc_enabled = false;
+extern bool _watch_host_usb_enabled;
+
+void _watch_init(void) {
+    // External wake depends on RTC; calendar is a required module.
+    _watch_rtc_init();
+}
+
+void _watch_enable_tcc(void) {
+    tcc_enabled = true;
+}
+
+void _watch_disable_tcc(void) {
+    tcc_enabled = false;
+}
+
+bool _watch_tcc_is_enabled(void) {
+    return tcc_enabled;
+}
+
+void _watch_enable_tc0(void) {}
+
+void _watch_disable_tc0(void) {}
+
+void _watch_enable_tc1(void) {}
+
+void _watch_disable_tc1(void) {}
+
+void _watch_enable_usb(void) {
+    // on the host, the "USB serial" is stdin and stdout.
+    _watch_host_usb_enabled = true;
+}
+
+void watch_disable_TRNG(void) {}
+
+void cdc_task(void) {}
@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_rtc.h"
+#include "watch_utility.h"
+#include "watch_host.h"
+
+ext_irq_cb_t tick_callbacks[8];
+ext_irq_cb_t alarm_callback;
+ext_irq_cb_t btn_alarm_callback;
+ext_irq_cb_t a2_callback;
+ext_irq_cb_t a4_callback;
+
+// the calendar is kept as a unix timestamp for the moment the virtual counter read zero.
+static uint32_t time_offset;
+static bool rtc_enabled = false;
+static uint8_t periodic_enabled;
+static bool alarm_enabled;
+static watch_date_time alarm_time;
+static watch_rtc_alarm_match alarm_mask;
+
+bool _watch_rtc_is_enabled(void) {
+    return rtc_enabled;
+}
+
+void _watch_rtc_init(void) {
+    rtc_enabled = true;
+}
+
+static watch_date_time _watch_rtc_date_time_at(uint64_t counter) {
+    uint32_t timestamp = time_offset + (uint32_t)(counter / WATCH_HOST_COUNTS_PER_SECOND);
+    return watch_utility_date_time_from_unix_time(timestamp, 0);
+}
+
+void watch_rtc_set_date_time(watch_date_time date_time) {
+    // like the real RTC, setting the clock does not reset the prescaler, so the subsecond phase is preserved.
+    uint32_t elapsed = (uint32_t)(watch_host_get_counter() / WATCH_HOST_COUNTS_PER_SECOND);
+    time_offset = watch_utility_date_time_to_unix_time(date_time, 0) - elapsed;
+}
+
+watch_date_time watch_rtc_get_date_time(void) {
+    return _watch_rtc_date_time_at(watch_host_get_counter());
+}
+
+void watch_rtc_register_tick_callback(ext_irq_cb_t callback) {
+    watch_rtc_register_periodic_callback(callback, 1);
+}
+
+void watch_rtc_disable_tick_callback(void) {
+    watch_rtc_disable_periodic_callback(1);
+}
+
+void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
+    // we told them, it has to be a power of 2.
+    if (__builtin_popcount(frequency) != 1) return;
+
+    // this left-justifies the period in a 32-bit integer.
+    uint32_t tmp = (uint32_t)(frequency & 0xFF) << 24;
+    // now we can count the leading zeroes to get the value we need.
+    // 0x01 (1 Hz) will have 7 leading zeros for PER7. 0xF0 (128 Hz) will have no leading zeroes for PER0.
+    uint8_t per_n = __builtin_clz(tmp);
+
+    tick_callbacks[per_n] = callback;
+    periodic_enabled |= 1 << per_n;
+}
+
+void watch_rtc_disable_periodic_callback(uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1) return;
+    uint8_t per_n = __builtin_clz((uint32_t)(frequency & 0xFF) << 24);
+    periodic_enabled &= ~(1 << per_n);
+}
+
+void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
+    periodic_enabled &= ~mask;
+}
+
+void watch_rtc_disable_all_periodic_callbacks(void) {
+    watch_rtc_disable_matching_periodic_callbacks(0xFF);
+}
+
+void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time time, watch_rtc_alarm_match mask) {
+    alarm_callback = callback;
+    alarm_time = time;
+    alarm_mask = mask;
+    alarm_enabled = true;
+}
+
+void watch_rtc_disable_alarm_callback(void) {
+    alarm_enabled = false;
+}
+
+static bool _watch_rtc_alarm_matches(watch_date_time date_time) {
+    switch (alarm_mask) {
+        case ALARM_MATCH_SS:
+            return date_time.unit.second == alarm_time.unit.second;
+        case ALARM_MATCH_MMSS:
+            return date_time.unit.second == alarm_time.unit.second &&
+                   date_time.unit.minute == alarm_time.unit.minute;
+        case ALARM_MATCH_HHMMSS:
+            return date_time.unit.second == alarm_time.unit.second &&
+                   date_time.unit.minute == alarm_time.unit.minute &&
+                   date_time.unit.hour == alarm_time.unit.hour;
+        default:
+            return false;
+    }
+}
+
+uint64_t _watch_rtc_next_event(uint64_t now) {
+    uint64_t next = WATCH_HOST_NO_EVENT;
+
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        if (periodic_enabled & (1 << per_n)) {
+            // PERn fires every (8 << n) counts: PER0 at 128 Hz, PER7 at 1 Hz.
+            uint64_t period = 8 << per_n;
+            uint64_t candidate = (now / period + 1) * period;
+            if (candidate < next) next = candidate;
+        }
+    }
+
+    if (alarm_enabled) {
+        // the alarm can only fire on a second boundary.
+        uint64_t candidate = (now / WATCH_HOST_COUNTS_PER_SECOND + 1) * WATCH_HOST_COUNTS_PER_SECOND;
+        if (candidate < next) next = candidate;
+    }
+
+    return next;
+}
+
+void _watch_rtc_service(uint64_t now) {
+    // as in RTC_Handler, handle the periodic callbacks first, starting from PER7, the 1 Hz tick.
+    for (int8_t per_n = 7; per_n >= 0; per_n--) {
+        if ((periodic_enabled & (1 << per_n)) && (now % (8 << per_n)) == 0) {
+            watch_host_count_irq(WATCH_HOST_IRQ_RTC_PERIODIC);
+            watch_host_stats.periodic_irqs[per_n]++;
+            if (tick_callbacks[per_n] != NULL) tick_callbacks[per_n]();
+        }
+    }
+
+    // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, i.e. when the matching second ends.
+    if (alarm_enabled && now > 0 && (now % WATCH_HOST_COUNTS_PER_SECOND) == 0) {
+        if (_watch_rtc_alarm_matches(_watch_rtc_date_time_at(now - 1))) {
+            watch_host_count_irq(WATCH_HOST_IRQ_RTC_ALARM);
+            if (alarm_callback != NULL) alarm_callback();
+        }
+    }
+}
+
+void watch_rtc_enable(bool en) {
+    rtc_enabled = en;
+}
+
+void watch_rtc_freqcorr_write(int16_t value, int16_t sign) {
+    // Not simulated
+    (void) value;
+    (void) sign;
+}
@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_slcd.h"
+#include "watch_private_display.h"
+#include "watch_host.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Segmented Display
+
+// the SDATAL0-2 registers, one word per COM line.
+static uint32_t segment_data[3];
+static bool blink_running;
+static bool tick_running;
+
+// the running sequence, if any. the SLCD steps through it on its frame counter, or on the RTC alarm at the
+// top of each minute; either way the host steps it on the virtual clock.
+static const watch_display_frame_t *sequence_frames;
+static uint8_t sequence_length;
+static uint8_t sequence_frame;
+static uint64_t sequence_started_at;
+static uint64_t sequence_period;
+static bool sequence_running;
+
+void watch_enable_display(void) {
+    watch_clear_display();
+}
+
+void _watch_display_write_com(uint8_t com, uint32_t value) {
+    segment_data[com] = value;
+}
+
+uint32_t _watch_display_read_com(uint8_t com) {
+    return segment_data[com];
+}
+
+void watch_start_character_blink(char character, uint32_t duration) {
+    (void) duration;
+    // the SLCD blinks these segments on its own; the host keeps them lit.
+    watch_display_character(character, 7);
+    watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    blink_running = true;
+}
+
+void watch_stop_blink(void) {
+    blink_running = false;
+}
+
+void watch_start_tick_animation(uint32_t duration) {
+    (void) duration;
+    watch_display_character(' ', 8);
+    watch_set_pixel(0, 2);
+    tick_running = true;
+}
+
+bool watch_tick_animation_is_running(void) {
+    return tick_running;
+}
+
+void watch_stop_tick_animation(void) {
+    tick_running = false;
+    watch_display_character(' ', 8);
+}
+
+void _watch_display_start_sequence_clock(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration) {
+    sequence_frames = frames;
+    sequence_length = num_frames;
+    sequence_frame = 0;
+    sequence_started_at = watch_host_get_counter();
+    if (duration) {
+        // the frame counter can't count shorter than a frame, which at our frame rate is about a millisecond of counts.
+        sequence_period = ((uint64_t)duration * WATCH_HOST_COUNTS_PER_SECOND + 500) / 1000;
+        if (sequence_period == 0) sequence_period = 1;
+    } else {
+        // the sequence steps on the alarm's event output, with the interrupt off.
+        sequence_period = 0;
+        watch_rtc_disable_alarm_callback();
+    }
+    sequence_running = true;
+}
+
+void _watch_display_stop_sequence_clock(void) {
+    sequence_running = false;
+}
+
+uint64_t _watch_slcd_next_event(uint64_t now) {
+    if (!sequence_running) return WATCH_HOST_NO_EVENT;
+    if (sequence_period) return now + sequence_period - (now - sequence_started_at) % sequence_period;
+    // the alarm matches at second 59 and fires as that second ends.
+    uint8_t second = watch_rtc_get_date_time().unit.second;
+    return (now / WATCH_HOST_COUNTS_PER_SECOND + 60 - second) * WATCH_HOST_COUNTS_PER_SECOND;
+}
+
+void _watch_slcd_service(uint64_t now) {
+    if (!sequence_running) return;
+    if (sequence_period) {
+        if ((now - sequence_started_at) % sequence_period || now == sequence_started_at) return;
+    } else {
+        if (now % WATCH_HOST_COUNTS_PER_SECOND || watch_rtc_get_date_time().unit.second != 0) return;
+    }
+
+    // this is the DMA controller's job, so it costs the CPU nothing.
+    sequence_frame = (sequence_frame + 1) % sequence_length;
+    for (uint8_t com = 0; com < 3; com++) segment_data[com] = sequence_frames[sequence_frame].com[com];
+
+    if (!sequence_period && sequence_frame == sequence_length - 1) {
+        // the last transfer raises the DMA controller's interrupt.
+        sequence_running = false;
+        watch_host_count_irq(WATCH_HOST_IRQ_DMAC);
+        _watch_display_sequence_did_finish();
+    }
+}
+
+uint32_t _watch_host_get_segment_data(uint8_t com) {
+    return segment_data[com];
+}
+
+void _watch_host_get_display_text(const uint32_t frame[3], char *buf) {
+    for (uint8_t position = 0; position < Num_Chars; position++) {
+        // gather the seven (or eight) segments of this position into the bit layout of Character_Set.
+        uint64_t segmap = Segment_Map[position];
+        uint8_t segdata = 0;
+        uint8_t valid = 0;
+        for (int i = 0; i < 8; i++) {
+            uint8_t com = (segmap & 0xFF) >> 6;
+            uint8_t seg = segmap & 0x3F;
+            if (com <= 2) {
+                valid |= 1 << i;
+                if (frame[com] & (1ul << seg)) segdata |= 1 << i;
+            }
+            segmap = segmap >> 8;
+        }
+
+        // find the first glyph that lights exactly these segments. some positions share segments,
+        // so we only compare the segments that exist in this position.
+        buf[position] = '?';
+        for (uint8_t c = 0; c < sizeof(Character_Set); c++) {
+            if ((Character_Set[c] & valid) == segdata) {
+                buf[position] = c + 0x20;
+                break;
+            }
+        }
+    }
+    buf[Num_Chars] = 0;
+}
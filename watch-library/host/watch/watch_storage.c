@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "watch_storage.h"
+#include "watch_host.h"
+
+static uint8_t storage[NVMCTRL_ROW_SIZE * NVMCTRL_RWWEE_PAGES];
+
+// like _is_valid_address on the hardware: the access has to fall within the RWWEE area.
+static bool _is_valid_range(uint32_t row, uint32_t offset, uint32_t size) {
+    return row * NVMCTRL_ROW_SIZE + offset + size <= WATCH_HOST_STORAGE_ROWS * NVMCTRL_ROW_SIZE;
+}
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    if (!_is_valid_range(row, offset, size)) return false;
+    watch_host_stats.storage_reads++;
+    watch_host_stats.storage_bytes_read += size;
+    watch_host_stats.storage_busy_ns += (uint64_t)size * WATCH_HOST_STORAGE_READ_NS_PER_BYTE;
+    memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+
+    return true;
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    if (!_is_valid_range(row, offset, size)) return false;
+    // like the NVM controller, programming can only clear bits; erase sets them back to 1.
+    watch_host_stats.storage_writes++;
+    watch_host_stats.storage_bytes_written += size;
+    // each page the write touches is loaded into the page buffer and programmed on its own.
+    uint32_t pages = size ? (offset % NVMCTRL_PAGE_SIZE + size + NVMCTRL_PAGE_SIZE - 1) / NVMCTRL_PAGE_SIZE : 0;
+    watch_host_stats.storage_pages_programmed += pages;
+    watch_host_stats.storage_busy_ns += pages * WATCH_HOST_STORAGE_PAGE_PROGRAM_US * 1000ULL;
+    uint8_t *dest = storage + row * NVMCTRL_ROW_SIZE + offset;
+    for (uint32_t i = 0; i < size; i++) dest[i] &= buffer[i];
+
+    return true;
+}
+
+bool watch_storage_erase(uint32_t row) {
+    if (!_is_valid_range(row, 0, NVMCTRL_ROW_SIZE)) return false;
+    watch_host_stats.storage_erases++;
+    watch_host_stats.storage_row_erases[row]++;
+    watch_host_stats.storage_busy_ns += WATCH_HOST_STORAGE_ROW_ERASE_US * 1000ULL;
+    memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+
+    return true;
+}
+
+bool watch_storage_sync(void) {
+    // nothing to do here!
+    return true;
+}
+
+bool _watch_host_storage_load(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return false;
+    size_t read = fread(storage, 1, sizeof(storage), f);
+    fclose(f);
+    return read == sizeof(storage);
+}
+
+bool _watch_host_storage_save(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+    size_t written = fwrite(storage, 1, sizeof(storage), f);
+    fclose(f);
+    return written == sizeof(storage);
+}
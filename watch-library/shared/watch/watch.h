@@ -73,6 +73,7 @@
 #include "watch_uart.h"
 #include "watch_storage.h"
 #include "watch_deepsleep.h"
+#include "watch_perf.h"
 
 #include "watch_private.h"
 
@@ -101,10 +102,12 @@ void cdc_task(void);
   * @param len the number of bytes you wish to read, max 256.
   * @return The number of bytes read, or zero if no bytes were read.
   */
+#ifndef WATCH_HOST // on the host build, read() comes from the C library.
 int read(int file, char *ptr, int len);
+#endif
 
 /** @brief Disables the TRNG twice in order to work around silicon erratum 1.16.1.
  */
-void watch_disable_TRNG();
+void watch_disable_TRNG(void);
 
 #endif /* WATCH_H_ */
@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_PERF_H_INCLUDED
+#define _WATCH_PERF_H_INCLUDED
+////< @file watch_perf.h
+
+#include "watch.h"
+
+/** @addtogroup perf Performance Counters
+  * @brief This section covers functions for measuring how long your code runs, and how much of the
+  *        time the watch spends awake instead of in STANDBY.
+  * @details On the watch, time is counted with the SysTick timer, which runs from the CPU clock and
+  *          stops along with it in STANDBY. In the simulator and the host build it comes from the
+  *          browser's or the operating system's monotonic clock, so the numbers there tell you about
+  *          relative cost rather than what the SAM L22 would actually spend.
+  */
+/// @{
+
+typedef struct {
+    uint32_t wakes;         // times the CPU has come out of STANDBY
+    uint64_t awake_us;      // time spent running, including the current stretch
+} watch_perf_stats_t;
+
+/** @brief Returns a free-running timestamp in microseconds, for timing short stretches of code.
+  * @details Subtract an earlier reading from a later one (as uint32_t) to get the time between them.
+  *          The value wraps about every 71 minutes.
+  * @note On the watch, the 24-bit SysTick counter is extended in software, so it needs to be read at
+  *       least once every two seconds of awake time for the difference to be correct. The main loop
+  *       and delay_ms take care of this; you only need to worry about it inside a single long-running call.
+  */
+uint32_t watch_perf_get_us(void);
+
+/// Returns the number of wakes and the total time spent awake since boot, or since the last reset.
+watch_perf_stats_t watch_perf_get_stats(void);
+
+/// Resets the counters returned by watch_perf_get_stats.
+void watch_perf_reset_stats(void);
+
+/// @}
+#endif
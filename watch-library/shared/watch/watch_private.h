@@ -53,4 +53,23 @@ void _watch_disable_tc1(void);
 /// Called by main.c if plugged in to USB. You should not call this from your app.
 void _watch_enable_usb(void);
 
+/// Adds the time since the last reading to the one watch_perf_get_us returns. Called before the CPU clock changes,
+/// so that the time so far is counted at the old rate. You should not call this from your app.
+void _watch_perf_update(void);
+
+/// Called just before the CPU enters STANDBY, to close out the current stretch of awake time.
+void _watch_perf_will_sleep(void);
+
+/// Called when the CPU comes out of STANDBY, to count the wake and start a new stretch of awake time.
+void _watch_perf_did_wake(void);
+
+/// Writes one COM line's worth of segment data (the SDATALn register) to the display. Called by watch_display_commit.
+void _watch_display_write_com(uint8_t com, uint32_t value);
+
+/// Forgets what the display is showing, so that the next commit rewrites every COM line. Call after the SLCD is reset.
+void _watch_display_invalidate(void);
+
+/// Reads back one COM line's worth of segment data, i.e. what the display is actually showing.
+uint32_t _watch_display_read_com(uint8_t com);
+
 #endif
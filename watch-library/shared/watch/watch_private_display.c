@@ -24,6 +24,9 @@
 
 #include "watch_slcd.h"
 #include "watch_private_display.h"
+#include "watch_private_display_glyphs.h"
+
+#include <string.h>
 
 static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(0, 17), // WATCH_INDICATOR_SIGNAL
@@ -33,96 +36,156 @@ static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(1, 10), // WATCH_INDICATOR_LAP
 };
 
-void watch_display_character(uint8_t character, uint8_t position) {
-    // special cases for positions 4 and 6
-    if (position == 4 || position == 6) {
-        if (character == '7') character = '&'; // "lowercase" 7
-        else if (character == 'A') character = 'a'; // A needs to be lowercase
-        else if (character == 'o') character = 'O'; // O needs to be uppercase
-        else if (character == 'L') character = '!'; // L needs to be in top half
-        else if (character == 'M' || character == 'm' || character == 'N') character = 'n'; // M and uppercase N need to be lowercase n
-        else if (character == 'c') character = 'C'; // C needs to be uppercase
-        else if (character == 'J') character = 'j'; // same
-        else if (character == 't' || character == 'T') character = '+'; // t in those locations looks like E otherwise
-        else if (character == 'y' || character == 'Y') character = '4'; // y in those locations looks like g otherwise
-        else if (character == 'v' || character == 'V' || character == 'U' || character == 'W' || character == 'w') character = 'u'; // bottom segment duplicated, so show in top half
-    } else {
-        if (character == 'u') character = 'v'; // we can use the bottom segment; move to lower half
-        else if (character == 'j') character = 'J'; // same but just display a normal J
-    }
-    if (position > 1) {
-        if (character == 'T') character = 't'; // uppercase T only works in positions 0 and 1
-    }
-    if (position == 1) {
-        if (character == 'a') character = 'A'; // A needs to be uppercase
-        else if (character == 'o') character = 'O'; // O needs to be uppercase
-        else if (character == 'i') character = 'l'; // I needs to be uppercase (use an l, it looks the same)
-        else if (character == 'n') character = 'N'; // N needs to be uppercase
-        else if (character == 'r') character = 'R'; // R needs to be uppercase
-        else if (character == 'd') character = 'D'; // D needs to be uppercase
-        else if (character == 'v' || character == 'V' || character == 'u') character = 'U'; // side segments shared, make uppercase
-        else if (character == 'b') character = 'B'; // B needs to be uppercase
-        else if (character == 'c') character = 'C'; // C needs to be uppercase
-    } else {
-        if (character == 'R') character = 'r'; // R needs to be lowercase almost everywhere
-    }
-    if (position == 0) {
-        watch_clear_pixel(0, 15); // clear funky ninth segment
-    } else {
-        if (character == 'I') character = 'l'; // uppercase I only works in position 0
-    }
+// Drawing happens in a RAM copy of the SDATAL0-2 registers, one word per COM line; watch_display_commit
+// then writes out only the lines that changed. The watch's segment pins all fall in SDATAL, so SDATAH is never used.
+static uint32_t display_shadow[3];
+static uint32_t display_committed[3];
 
-    uint64_t segmap = Segment_Map[position];
-    uint64_t segdata = Character_Set[character - 0x20];
+// The character each position is known to be showing, so that redrawing it can be skipped; 0 if unknown.
+// Anything that changes one of a position's segments by other means forgets that position's character.
+static uint8_t display_characters[10];
 
-    for (int i = 0; i < 8; i++) {
-        uint8_t com = (segmap & 0xFF) >> 6;
-        if (com > 2) {
-            // COM3 means no segment exists; skip it.
-            segmap = segmap >> 8;
-            segdata = segdata >> 1;
-            continue;
-        }
-        uint8_t seg = segmap & 0x3F;
+static watch_display_stats_t display_stats;
 
-        if (segdata & 1)
-          watch_set_pixel(com, seg);
-        else
-          watch_clear_pixel(com, seg);
+// The frames of the running sequence, if any. While it runs, the SLCD steps through these on its own, so
+// commits are held back until it stops.
+static watch_display_frame_t display_sequence[WATCH_DISPLAY_MAX_SEQUENCE_FRAMES];
+static volatile bool display_sequence_running;
+static ext_irq_cb_t display_sequence_callback;
 
-        segmap = segmap >> 8;
-        segdata = segdata >> 1;
+static void _watch_display_forget_character_at(uint8_t com, uint8_t seg) {
+    for (uint8_t position = 0; position < Num_Chars; position++) {
+        if (((uint32_t)Glyph_Position_Mask[position][com] << Glyph_Position_Shift[position]) & (1ul << seg)) {
+            display_characters[position] = 0;
+            return;
+        }
     }
+}
 
-    if (character == 'T' && position == 1) watch_set_pixel(1, 12); // add descender
-    else if (position == 0 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 15); // add funky ninth segment
-    else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 12); // add funky ninth segment
+void watch_set_pixel(uint8_t com, uint8_t seg) {
+    if (display_shadow[com] & (1ul << seg)) return;
+    display_shadow[com] |= (1ul << seg);
+    _watch_display_forget_character_at(com, seg);
 }
 
-void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
-    // Will only work for digits and for positions  8 and 9 - but less code & checks to reduce power consumption
-
-    uint64_t segmap = Segment_Map[position];
-    uint64_t segdata = Character_Set[character - 0x20];
-
-    for (int i = 0; i < 8; i++) {
-        uint8_t com = (segmap & 0xFF) >> 6;
-        if (com > 2) {
-            // COM3 means no segment exists; skip it.
-            segmap = segmap >> 8;
-            segdata = segdata >> 1;
-            continue;
+void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (!(display_shadow[com] & (1ul << seg))) return;
+    display_shadow[com] &= ~(1ul << seg);
+    _watch_display_forget_character_at(com, seg);
+}
+
+void watch_clear_display(void) {
+    display_shadow[0] = 0;
+    display_shadow[1] = 0;
+    display_shadow[2] = 0;
+    // a blank position is exactly what a space draws.
+    memset(display_characters, ' ', sizeof(display_characters));
+}
+
+void watch_display_commit(void) {
+    if (display_sequence_running) return;
+    display_stats.commits++;
+    for (uint8_t com = 0; com < 3; com++) {
+        if (display_shadow[com] != display_committed[com]) {
+            _watch_display_write_com(com, display_shadow[com]);
+            display_committed[com] = display_shadow[com];
+            display_stats.register_writes++;
         }
-        uint8_t seg = segmap & 0x3F;
+    }
+}
+
+watch_display_stats_t watch_display_get_stats(void) {
+    return display_stats;
+}
+
+void watch_display_reset_stats(void) {
+    memset(&display_stats, 0, sizeof(display_stats));
+}
+
+void _watch_display_invalidate(void) {
+    for (uint8_t com = 0; com < 3; com++) display_committed[com] = ~display_shadow[com];
+}
+
+void watch_display_capture_frame(watch_display_frame_t *frame) {
+    memcpy(frame->com, display_shadow, sizeof(frame->com));
+}
 
-        if (segdata & 1)
-          watch_set_pixel(com, seg);
-        else
-          watch_clear_pixel(com, seg);
+static void _watch_display_start_sequence(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration, ext_irq_cb_t callback) {
+    watch_display_stop_sequence();
+    if (num_frames == 0) return;
+    if (num_frames > WATCH_DISPLAY_MAX_SEQUENCE_FRAMES) num_frames = WATCH_DISPLAY_MAX_SEQUENCE_FRAMES;
+    memcpy(display_sequence, frames, num_frames * sizeof(watch_display_frame_t));
 
-        segmap = segmap >> 8;
-        segdata = segdata >> 1;
+    // the first frame goes up like anything else drawn; we no longer know what characters it holds.
+    memcpy(display_shadow, display_sequence[0].com, sizeof(display_shadow));
+    memset(display_characters, 0, sizeof(display_characters));
+    watch_display_commit();
+    if (num_frames == 1) return;
+
+    display_sequence_callback = callback;
+    display_sequence_running = true;
+    _watch_display_start_sequence_clock(display_sequence, num_frames, duration);
+}
+
+void watch_display_start_sequence(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration) {
+    // a duration of zero means the minute clock to the platform, so keep it out of reach.
+    if (duration == 0) duration = 1;
+    _watch_display_start_sequence(frames, num_frames, duration, NULL);
+}
+
+void watch_display_start_minute_sequence(const watch_display_frame_t *frames, uint8_t num_frames, ext_irq_cb_t callback) {
+    _watch_display_start_sequence(frames, num_frames, 0, callback);
+}
+
+bool watch_display_sequence_is_running(void) {
+    return display_sequence_running;
+}
+
+static void _watch_display_take_over_from_sequence(void) {
+    // drawing carries on from whichever frame the sequence left up.
+    for (uint8_t com = 0; com < 3; com++) {
+        display_shadow[com] = _watch_display_read_com(com);
+        display_committed[com] = display_shadow[com];
     }
+    memset(display_characters, 0, sizeof(display_characters));
+    display_sequence_running = false;
+}
+
+void watch_display_stop_sequence(void) {
+    if (!display_sequence_running) return;
+    _watch_display_stop_sequence_clock();
+    _watch_display_take_over_from_sequence();
+}
+
+void _watch_display_sequence_did_finish(void) {
+    _watch_display_take_over_from_sequence();
+    if (display_sequence_callback != NULL) display_sequence_callback();
+}
+
+void watch_display_character(uint8_t character, uint8_t position) {
+    // the glyph table has already made every per-position substitution (lowercase 7, uppercase A in position 1,
+    // and so on) and added the descender and funky ninth segments, so all that's left is to store the segments.
+    if (character < GLYPH_TABLE_FIRST_CHARACTER || character >= GLYPH_TABLE_FIRST_CHARACTER + GLYPH_TABLE_NUM_CHARACTERS) character = ' ';
+    if (display_characters[position] == character) {
+        display_stats.characters_skipped++;
+        return;
+    }
+    display_characters[position] = character;
+    display_stats.characters_drawn++;
+
+    const uint16_t *glyph = Glyph_Table[position][character - GLYPH_TABLE_FIRST_CHARACTER];
+    const uint16_t *mask = Glyph_Position_Mask[position];
+    uint8_t shift = Glyph_Position_Shift[position];
+
+    display_shadow[0] = (display_shadow[0] & ~((uint32_t)mask[0] << shift)) | ((uint32_t)glyph[0] << shift);
+    display_shadow[1] = (display_shadow[1] & ~((uint32_t)mask[1] << shift)) | ((uint32_t)glyph[1] << shift);
+    display_shadow[2] = (display_shadow[2] & ~((uint32_t)mask[2] << shift)) | ((uint32_t)glyph[2] << shift);
+}
+
+void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
+    // Will only work for digits and for positions  8 and 9. This used to skip the substitutions above to save
+    // power; now that they're precomputed, both functions cost the same.
+    watch_display_character(character, position);
 }
 
 void watch_display_string(char *string, uint8_t position) {
@@ -139,6 +202,70 @@ void watch_display_string(char *string, uint8_t position) {
     // printf("________\n  %c%c  %c%c\n%c%c %c%c %c%c\n--------\n", (position > 0) ? ' ' : string[0], (position > 1) ? ' ' : string[1 - position], (position > 2) ? ' ' : string[2 - position], (position > 3) ? ' ' : string[3 - position], (position > 4) ? ' ' : string[4 - position], (position > 5) ? ' ' : string[5 - position], (position > 6) ? ' ' : string[6 - position], (position > 7) ? ' ' : string[7 - position], (position > 8) ? ' ' : string[8 - position], (position > 9) ? ' ' : string[9 - position]);
 }
 
+// n / 10, by multiplying by a reciprocal: the Cortex-M0+ has no divide instruction, and the library call for
+// one loops over every bit. 0xCCCD / 2^19 is exact for n < 81920 and fits a 32-bit multiply; past that it
+// takes a 64-bit one, which is still much cheaper than a division.
+static inline uint32_t _watch_display_div10(uint32_t n) {
+    if (n < 81920) return (n * 0xCCCDu) >> 19;
+    return (uint32_t)(((uint64_t)n * 0xCCCCCCCDu) >> 35);
+}
+
+static void _watch_display_number(uint32_t magnitude, bool negative, uint8_t places, uint8_t position, uint8_t width, watch_display_pad_t pad) {
+    char field[10];
+    if (width > Num_Chars) width = Num_Chars;
+    if (width == 0) return;
+
+    // a minus sign always keeps its place, so a number too long for the field loses leading digits, never the sign.
+    uint8_t sign_width = negative ? 1 : 0;
+
+    // fill the field from the right: the digits, with the point after the first `places` of them...
+    uint8_t i = width;
+    uint8_t digits = 0;
+    while (i > sign_width) {
+        uint32_t quotient = _watch_display_div10(magnitude);
+        field[--i] = '0' + (magnitude - quotient * 10);
+        magnitude = quotient;
+        digits++;
+        if (digits == places && i > sign_width) field[--i] = '.';
+        if (magnitude == 0 && digits > places) break;
+    }
+
+    // ...then the sign and the padding.
+    if (pad == WATCH_DISPLAY_PAD_ZERO) {
+        while (i > sign_width) field[--i] = '0';
+        if (negative) field[--i] = '-';
+    } else {
+        if (negative) field[--i] = '-';
+        if (pad == WATCH_DISPLAY_PAD_LEFT && i > 0) {
+            memmove(field, field + i, width - i);
+            memset(field + width - i, ' ', i);
+            i = 0;
+        }
+        while (i > 0) field[--i] = ' ';
+    }
+
+    for (i = 0; i < width && position + i < Num_Chars; i++) watch_display_character(field[i], position + i);
+}
+
+void watch_display_uint(uint32_t value, uint8_t position, uint8_t width, watch_display_pad_t pad) {
+    _watch_display_number(value, false, 0, position, width, pad);
+}
+
+void watch_display_int(int32_t value, uint8_t position, uint8_t width, watch_display_pad_t pad) {
+    // negating in unsigned arithmetic gets INT32_MIN right, too.
+    _watch_display_number(value < 0 ? -(uint32_t)value : (uint32_t)value, value < 0, 0, position, width, pad);
+}
+
+void watch_display_fixed(int32_t value, uint8_t places, uint8_t position, uint8_t width, watch_display_pad_t pad) {
+    _watch_display_number(value < 0 ? -(uint32_t)value : (uint32_t)value, value < 0, places, position, width, pad);
+}
+
+void watch_display_time(uint8_t hour, uint8_t minute, uint8_t second, bool leading_zero) {
+    _watch_display_number(hour, false, 0, 4, 2, leading_zero ? WATCH_DISPLAY_PAD_ZERO : WATCH_DISPLAY_PAD_SPACE);
+    _watch_display_number(minute, false, 0, 6, 2, WATCH_DISPLAY_PAD_ZERO);
+    _watch_display_number(second, false, 0, 8, 2, WATCH_DISPLAY_PAD_ZERO);
+}
+
 void watch_set_colon(void) {
     watch_set_pixel(1, 16);
 }
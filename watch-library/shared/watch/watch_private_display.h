@@ -26,6 +26,7 @@
 
 #include "hpl_slcd_config.h"
 #include "driver_init.h"
+#include "watch_slcd.h"
 
 static const uint8_t Character_Set[] =
 {
@@ -144,5 +145,18 @@ static const uint8_t Num_Chars = 10;
 void watch_display_character(uint8_t character, uint8_t position);
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
 
+/** @brief Starts stepping the display through a sequence, which is already showing frames[0].
+  * @details If duration is nonzero, steps every duration ms and wraps around at the end; if it is zero, steps at the
+  *          top of each minute on the RTC alarm, and calls _watch_display_sequence_did_finish once the last frame is up.
+  *          The frames stay valid until the sequence is stopped.
+  */
+void _watch_display_start_sequence_clock(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration);
+
+/// Stops stepping the display through the sequence.
+void _watch_display_stop_sequence_clock(void);
+
+/// Called once a sequence that ran on the RTC alarm has put up its last frame, with the sequence clock already stopped.
+void _watch_display_sequence_did_finish(void);
+
 
 #endif
@@ -0,0 +1,1002 @@
+// Generated by utils/display_glyphs/generate_glyph_table.py from watch_private_display.h. Do not edit.
+#ifndef _WATCH_PRIVATE_DISPLAY_GLYPHS_H_INCLUDED
+#define _WATCH_PRIVATE_DISPLAY_GLYPHS_H_INCLUDED
+
+#include <stdint.h>
+
+#define GLYPH_TABLE_FIRST_CHARACTER 0x20
+#define GLYPH_TABLE_NUM_CHARACTERS 95
+
+// Every segment a position can touch sits within 16 pins of each other, so each position's segments
+// are stored as 16-bit masks relative to its lowest segment pin.
+static const uint8_t Glyph_Position_Shift[] = { 13, 11, 9, 6, 18, 17, 22, 0, 2, 4 };
+
+// The segments each position owns on COM0-2, relative to Glyph_Position_Shift.
+static const uint16_t Glyph_Position_Mask[][3] = {
+    { 0x0007, 0x0007, 0x0007 }, // Position 0
+    { 0x0003, 0x0003, 0x0003 }, // Position 1
+    { 0x0003, 0x0001, 0x0001 }, // Position 2
+    { 0x0006, 0x0006, 0x0007 }, // Position 3
+    { 0x0003, 0x0003, 0x0003 }, // Position 4
+    { 0x0018, 0x0019, 0x0018 }, // Position 5
+    { 0x0003, 0x0003, 0x0003 }, // Position 6
+    { 0x0003, 0x0003, 0x0403 }, // Position 7
+    { 0x0007, 0x0003, 0x0003 }, // Position 8
+    { 0x0006, 0x0007, 0x0003 }, // Position 9
+};
+
+// The segments to light on COM0-2 for each position and character, relative to Glyph_Position_Shift.
+static const uint16_t Glyph_Table[][GLYPH_TABLE_NUM_CHARACTERS][3] = {
+    { // Position 0
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0002, 0x0004, 0x0000 }, // !
+        { 0x0002, 0x0001, 0x0000 }, // "
+        { 0x0003, 0x0005, 0x0000 }, // #
+        { 0x0003, 0x0000, 0x0005 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0000, 0x0004, 0x0001 }, // &
+        { 0x0002, 0x0000, 0x0000 }, // '
+        { 0x0003, 0x0000, 0x0006 }, // (
+        { 0x0001, 0x0001, 0x0005 }, // )
+        { 0x0000, 0x0006, 0x0000 }, // *
+        { 0x0002, 0x0004, 0x0002 }, // +
+        { 0x0000, 0x0000, 0x0001 }, // ,
+        { 0x0000, 0x0004, 0x0000 }, // -
+        { 0x0000, 0x0004, 0x0000 }, // .
+        { 0x0000, 0x0001, 0x0002 }, // /
+        { 0x0003, 0x0001, 0x0007 }, // 0
+        { 0x0000, 0x0001, 0x0001 }, // 1
+        { 0x0001, 0x0005, 0x0006 }, // 2
+        { 0x0001, 0x0005, 0x0005 }, // 3
+        { 0x0002, 0x0005, 0x0001 }, // 4
+        { 0x0003, 0x0004, 0x0005 }, // 5
+        { 0x0003, 0x0004, 0x0007 }, // 6
+        { 0x0001, 0x0001, 0x0001 }, // 7
+        { 0x0003, 0x0005, 0x0007 }, // 8
+        { 0x0003, 0x0005, 0x0005 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0000, 0x0004, 0x0006 }, // <
+        { 0x0000, 0x0004, 0x0004 }, // =
+        { 0x0000, 0x0004, 0x0005 }, // >
+        { 0x0001, 0x0005, 0x0002 }, // ?
+        { 0x0007, 0x0007, 0x0007 }, // @
+        { 0x0003, 0x0005, 0x0003 }, // A
+        { 0x0007, 0x0005, 0x0007 }, // B
+        { 0x0003, 0x0000, 0x0006 }, // C
+        { 0x0007, 0x0001, 0x0007 }, // D
+        { 0x0003, 0x0004, 0x0006 }, // E
+        { 0x0003, 0x0004, 0x0002 }, // F
+        { 0x0003, 0x0000, 0x0007 }, // G
+        { 0x0002, 0x0005, 0x0003 }, // H
+        { 0x0001, 0x0002, 0x0004 }, // I
+        { 0x0000, 0x0001, 0x0005 }, // J
+        { 0x0003, 0x0004, 0x0003 }, // K
+        { 0x0002, 0x0000, 0x0006 }, // L
+        { 0x0003, 0x0003, 0x0003 }, // M
+        { 0x0003, 0x0001, 0x0003 }, // N
+        { 0x0003, 0x0001, 0x0007 }, // O
+        { 0x0003, 0x0005, 0x0002 }, // P
+        { 0x0003, 0x0005, 0x0001 }, // Q
+        { 0x0000, 0x0004, 0x0002 }, // R
+        { 0x0003, 0x0004, 0x0005 }, // S
+        { 0x0001, 0x0002, 0x0000 }, // T
+        { 0x0002, 0x0001, 0x0007 }, // U
+        { 0x0002, 0x0001, 0x0007 }, // V
+        { 0x0002, 0x0003, 0x0007 }, // W
+        { 0x0002, 0x0005, 0x0007 }, // X
+        { 0x0002, 0x0005, 0x0005 }, // Y
+        { 0x0001, 0x0001, 0x0006 }, // Z
+        { 0x0003, 0x0000, 0x0006 }, // [
+        { 0x0002, 0x0000, 0x0001 }, // backslash
+        { 0x0001, 0x0001, 0x0005 }, // ]
+        { 0x0003, 0x0001, 0x0000 }, // ^
+        { 0x0000, 0x0000, 0x0004 }, // _
+        { 0x0000, 0x0001, 0x0000 }, // `
+        { 0x0001, 0x0005, 0x0007 }, // a
+        { 0x0002, 0x0004, 0x0007 }, // b
+        { 0x0000, 0x0004, 0x0006 }, // c
+        { 0x0000, 0x0005, 0x0007 }, // d
+        { 0x0003, 0x0005, 0x0006 }, // e
+        { 0x0003, 0x0004, 0x0002 }, // f
+        { 0x0003, 0x0005, 0x0005 }, // g
+        { 0x0002, 0x0004, 0x0003 }, // h
+        { 0x0000, 0x0000, 0x0002 }, // i
+        { 0x0000, 0x0001, 0x0005 }, // j
+        { 0x0003, 0x0004, 0x0003 }, // k
+        { 0x0002, 0x0000, 0x0002 }, // l
+        { 0x0003, 0x0003, 0x0003 }, // m
+        { 0x0000, 0x0004, 0x0003 }, // n
+        { 0x0000, 0x0004, 0x0007 }, // o
+        { 0x0003, 0x0005, 0x0002 }, // p
+        { 0x0003, 0x0005, 0x0001 }, // q
+        { 0x0000, 0x0004, 0x0002 }, // r
+        { 0x0003, 0x0004, 0x0005 }, // s
+        { 0x0002, 0x0004, 0x0006 }, // t
+        { 0x0000, 0x0000, 0x0007 }, // u
+        { 0x0000, 0x0000, 0x0007 }, // v
+        { 0x0002, 0x0003, 0x0007 }, // w
+        { 0x0002, 0x0005, 0x0007 }, // x
+        { 0x0002, 0x0005, 0x0005 }, // y
+        { 0x0001, 0x0001, 0x0006 }, // z
+        { 0x0000, 0x0001, 0x0003 }, // {
+        { 0x0002, 0x0001, 0x0003 }, // |
+        { 0x0002, 0x0000, 0x0003 }, // }
+        { 0x0001, 0x0000, 0x0000 }, // ~
+    },
+    { // Position 1
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0002, 0x0002 }, // !
+        { 0x0000, 0x0002, 0x0000 }, // "
+        { 0x0001, 0x0002, 0x0002 }, // #
+        { 0x0001, 0x0003, 0x0001 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0000, 0x0001, 0x0002 }, // &
+        { 0x0000, 0x0002, 0x0000 }, // '
+        { 0x0001, 0x0002, 0x0001 }, // (
+        { 0x0001, 0x0001, 0x0001 }, // )
+        { 0x0002, 0x0000, 0x0002 }, // *
+        { 0x0000, 0x0002, 0x0002 }, // +
+        { 0x0000, 0x0001, 0x0000 }, // ,
+        { 0x0000, 0x0000, 0x0002 }, // -
+        { 0x0000, 0x0000, 0x0002 }, // .
+        { 0x0000, 0x0000, 0x0000 }, // /
+        { 0x0001, 0x0003, 0x0001 }, // 0
+        { 0x0000, 0x0001, 0x0000 }, // 1
+        { 0x0001, 0x0000, 0x0003 }, // 2
+        { 0x0001, 0x0001, 0x0003 }, // 3
+        { 0x0000, 0x0003, 0x0002 }, // 4
+        { 0x0001, 0x0003, 0x0003 }, // 5
+        { 0x0001, 0x0003, 0x0003 }, // 6
+        { 0x0001, 0x0001, 0x0000 }, // 7
+        { 0x0001, 0x0003, 0x0003 }, // 8
+        { 0x0001, 0x0003, 0x0003 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0000, 0x0000, 0x0003 }, // <
+        { 0x0000, 0x0000, 0x0003 }, // =
+        { 0x0000, 0x0001, 0x0003 }, // >
+        { 0x0001, 0x0000, 0x0002 }, // ?
+        { 0x0003, 0x0003, 0x0003 }, // @
+        { 0x0001, 0x0003, 0x0002 }, // A
+        { 0x0003, 0x0003, 0x0003 }, // B
+        { 0x0001, 0x0002, 0x0001 }, // C
+        { 0x0003, 0x0003, 0x0001 }, // D
+        { 0x0001, 0x0002, 0x0003 }, // E
+        { 0x0001, 0x0002, 0x0002 }, // F
+        { 0x0001, 0x0003, 0x0001 }, // G
+        { 0x0000, 0x0003, 0x0002 }, // H
+        { 0x0000, 0x0002, 0x0000 }, // I
+        { 0x0000, 0x0001, 0x0001 }, // J
+        { 0x0001, 0x0003, 0x0002 }, // K
+        { 0x0000, 0x0002, 0x0001 }, // L
+        { 0x0003, 0x0003, 0x0000 }, // M
+        { 0x0001, 0x0003, 0x0000 }, // N
+        { 0x0001, 0x0003, 0x0001 }, // O
+        { 0x0001, 0x0002, 0x0002 }, // P
+        { 0x0001, 0x0003, 0x0002 }, // Q
+        { 0x0003, 0x0003, 0x0002 }, // R
+        { 0x0001, 0x0003, 0x0003 }, // S
+        { 0x0003, 0x0002, 0x0000 }, // T
+        { 0x0000, 0x0003, 0x0001 }, // U
+        { 0x0000, 0x0003, 0x0001 }, // V
+        { 0x0002, 0x0003, 0x0001 }, // W
+        { 0x0000, 0x0003, 0x0003 }, // X
+        { 0x0000, 0x0003, 0x0003 }, // Y
+        { 0x0001, 0x0000, 0x0001 }, // Z
+        { 0x0001, 0x0002, 0x0001 }, // [
+        { 0x0000, 0x0003, 0x0000 }, // backslash
+        { 0x0001, 0x0001, 0x0001 }, // ]
+        { 0x0001, 0x0002, 0x0000 }, // ^
+        { 0x0000, 0x0000, 0x0001 }, // _
+        { 0x0000, 0x0000, 0x0000 }, // `
+        { 0x0001, 0x0003, 0x0002 }, // a
+        { 0x0003, 0x0003, 0x0003 }, // b
+        { 0x0001, 0x0002, 0x0001 }, // c
+        { 0x0003, 0x0003, 0x0001 }, // d
+        { 0x0001, 0x0002, 0x0003 }, // e
+        { 0x0001, 0x0002, 0x0002 }, // f
+        { 0x0001, 0x0003, 0x0003 }, // g
+        { 0x0000, 0x0003, 0x0002 }, // h
+        { 0x0000, 0x0002, 0x0000 }, // i
+        { 0x0000, 0x0001, 0x0001 }, // j
+        { 0x0001, 0x0003, 0x0002 }, // k
+        { 0x0000, 0x0002, 0x0000 }, // l
+        { 0x0003, 0x0003, 0x0000 }, // m
+        { 0x0001, 0x0003, 0x0000 }, // n
+        { 0x0001, 0x0003, 0x0001 }, // o
+        { 0x0001, 0x0002, 0x0002 }, // p
+        { 0x0001, 0x0003, 0x0002 }, // q
+        { 0x0003, 0x0003, 0x0002 }, // r
+        { 0x0001, 0x0003, 0x0003 }, // s
+        { 0x0000, 0x0002, 0x0003 }, // t
+        { 0x0000, 0x0003, 0x0001 }, // u
+        { 0x0000, 0x0003, 0x0001 }, // v
+        { 0x0002, 0x0003, 0x0001 }, // w
+        { 0x0000, 0x0003, 0x0003 }, // x
+        { 0x0000, 0x0003, 0x0003 }, // y
+        { 0x0001, 0x0000, 0x0001 }, // z
+        { 0x0000, 0x0001, 0x0000 }, // {
+        { 0x0000, 0x0003, 0x0000 }, // |
+        { 0x0000, 0x0003, 0x0000 }, // }
+        { 0x0001, 0x0000, 0x0000 }, // ~
+    },
+    { // Position 2
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0001, 0x0000 }, // !
+        { 0x0001, 0x0000, 0x0000 }, // "
+        { 0x0001, 0x0001, 0x0000 }, // #
+        { 0x0000, 0x0000, 0x0001 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0000, 0x0001, 0x0001 }, // &
+        { 0x0000, 0x0000, 0x0000 }, // '
+        { 0x0002, 0x0000, 0x0000 }, // (
+        { 0x0001, 0x0000, 0x0001 }, // )
+        { 0x0000, 0x0001, 0x0000 }, // *
+        { 0x0002, 0x0001, 0x0000 }, // +
+        { 0x0000, 0x0000, 0x0001 }, // ,
+        { 0x0000, 0x0001, 0x0000 }, // -
+        { 0x0000, 0x0001, 0x0000 }, // .
+        { 0x0003, 0x0000, 0x0000 }, // /
+        { 0x0003, 0x0000, 0x0001 }, // 0
+        { 0x0001, 0x0000, 0x0001 }, // 1
+        { 0x0003, 0x0001, 0x0000 }, // 2
+        { 0x0001, 0x0001, 0x0001 }, // 3
+        { 0x0001, 0x0001, 0x0001 }, // 4
+        { 0x0000, 0x0001, 0x0001 }, // 5
+        { 0x0002, 0x0001, 0x0001 }, // 6
+        { 0x0001, 0x0000, 0x0001 }, // 7
+        { 0x0003, 0x0001, 0x0001 }, // 8
+        { 0x0001, 0x0001, 0x0001 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0002, 0x0001, 0x0000 }, // <
+        { 0x0000, 0x0001, 0x0000 }, // =
+        { 0x0000, 0x0001, 0x0001 }, // >
+        { 0x0003, 0x0001, 0x0000 }, // ?
+        { 0x0003, 0x0001, 0x0001 }, // @
+        { 0x0003, 0x0001, 0x0001 }, // A
+        { 0x0003, 0x0001, 0x0001 }, // B
+        { 0x0002, 0x0000, 0x0000 }, // C
+        { 0x0003, 0x0000, 0x0001 }, // D
+        { 0x0002, 0x0001, 0x0000 }, // E
+        { 0x0002, 0x0001, 0x0000 }, // F
+        { 0x0002, 0x0000, 0x0001 }, // G
+        { 0x0003, 0x0001, 0x0001 }, // H
+        { 0x0002, 0x0000, 0x0000 }, // I
+        { 0x0001, 0x0000, 0x0001 }, // J
+        { 0x0002, 0x0001, 0x0001 }, // K
+        { 0x0002, 0x0000, 0x0000 }, // L
+        { 0x0003, 0x0000, 0x0001 }, // M
+        { 0x0003, 0x0000, 0x0001 }, // N
+        { 0x0003, 0x0000, 0x0001 }, // O
+        { 0x0003, 0x0001, 0x0000 }, // P
+        { 0x0001, 0x0001, 0x0001 }, // Q
+        { 0x0002, 0x0001, 0x0000 }, // R
+        { 0x0000, 0x0001, 0x0001 }, // S
+        { 0x0002, 0x0001, 0x0000 }, // T
+        { 0x0003, 0x0000, 0x0001 }, // U
+        { 0x0003, 0x0000, 0x0001 }, // V
+        { 0x0003, 0x0000, 0x0001 }, // W
+        { 0x0003, 0x0001, 0x0001 }, // X
+        { 0x0001, 0x0001, 0x0001 }, // Y
+        { 0x0003, 0x0000, 0x0000 }, // Z
+        { 0x0002, 0x0000, 0x0000 }, // [
+        { 0x0000, 0x0000, 0x0001 }, // backslash
+        { 0x0001, 0x0000, 0x0001 }, // ]
+        { 0x0001, 0x0000, 0x0000 }, // ^
+        { 0x0000, 0x0000, 0x0000 }, // _
+        { 0x0001, 0x0000, 0x0000 }, // `
+        { 0x0003, 0x0001, 0x0001 }, // a
+        { 0x0002, 0x0001, 0x0001 }, // b
+        { 0x0002, 0x0001, 0x0000 }, // c
+        { 0x0003, 0x0001, 0x0001 }, // d
+        { 0x0003, 0x0001, 0x0000 }, // e
+        { 0x0002, 0x0001, 0x0000 }, // f
+        { 0x0001, 0x0001, 0x0001 }, // g
+        { 0x0002, 0x0001, 0x0001 }, // h
+        { 0x0002, 0x0000, 0x0000 }, // i
+        { 0x0001, 0x0000, 0x0001 }, // j
+        { 0x0002, 0x0001, 0x0001 }, // k
+        { 0x0002, 0x0000, 0x0000 }, // l
+        { 0x0003, 0x0000, 0x0001 }, // m
+        { 0x0002, 0x0001, 0x0001 }, // n
+        { 0x0002, 0x0001, 0x0001 }, // o
+        { 0x0003, 0x0001, 0x0000 }, // p
+        { 0x0001, 0x0001, 0x0001 }, // q
+        { 0x0002, 0x0001, 0x0000 }, // r
+        { 0x0000, 0x0001, 0x0001 }, // s
+        { 0x0002, 0x0001, 0x0000 }, // t
+        { 0x0002, 0x0000, 0x0001 }, // u
+        { 0x0002, 0x0000, 0x0001 }, // v
+        { 0x0003, 0x0000, 0x0001 }, // w
+        { 0x0003, 0x0001, 0x0001 }, // x
+        { 0x0001, 0x0001, 0x0001 }, // y
+        { 0x0003, 0x0000, 0x0000 }, // z
+        { 0x0003, 0x0000, 0x0001 }, // {
+        { 0x0003, 0x0000, 0x0001 }, // |
+        { 0x0002, 0x0000, 0x0001 }, // }
+        { 0x0000, 0x0000, 0x0000 }, // ~
+    },
+    { // Position 3
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0004, 0x0004, 0x0000 }, // !
+        { 0x0004, 0x0002, 0x0000 }, // "
+        { 0x0006, 0x0006, 0x0000 }, // #
+        { 0x0006, 0x0000, 0x0003 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0000, 0x0004, 0x0002 }, // &
+        { 0x0004, 0x0000, 0x0000 }, // '
+        { 0x0006, 0x0000, 0x0005 }, // (
+        { 0x0002, 0x0002, 0x0003 }, // )
+        { 0x0000, 0x0004, 0x0000 }, // *
+        { 0x0004, 0x0004, 0x0004 }, // +
+        { 0x0000, 0x0000, 0x0002 }, // ,
+        { 0x0000, 0x0004, 0x0000 }, // -
+        { 0x0000, 0x0004, 0x0000 }, // .
+        { 0x0000, 0x0002, 0x0004 }, // /
+        { 0x0006, 0x0002, 0x0007 }, // 0
+        { 0x0000, 0x0002, 0x0002 }, // 1
+        { 0x0002, 0x0006, 0x0005 }, // 2
+        { 0x0002, 0x0006, 0x0003 }, // 3
+        { 0x0004, 0x0006, 0x0002 }, // 4
+        { 0x0006, 0x0004, 0x0003 }, // 5
+        { 0x0006, 0x0004, 0x0007 }, // 6
+        { 0x0002, 0x0002, 0x0002 }, // 7
+        { 0x0006, 0x0006, 0x0007 }, // 8
+        { 0x0006, 0x0006, 0x0003 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0000, 0x0004, 0x0005 }, // <
+        { 0x0000, 0x0004, 0x0001 }, // =
+        { 0x0000, 0x0004, 0x0003 }, // >
+        { 0x0002, 0x0006, 0x0004 }, // ?
+        { 0x0006, 0x0006, 0x0007 }, // @
+        { 0x0006, 0x0006, 0x0006 }, // A
+        { 0x0006, 0x0006, 0x0007 }, // B
+        { 0x0006, 0x0000, 0x0005 }, // C
+        { 0x0006, 0x0002, 0x0007 }, // D
+        { 0x0006, 0x0004, 0x0005 }, // E
+        { 0x0006, 0x0004, 0x0004 }, // F
+        { 0x0006, 0x0000, 0x0007 }, // G
+        { 0x0004, 0x0006, 0x0006 }, // H
+        { 0x0004, 0x0000, 0x0004 }, // I
+        { 0x0000, 0x0002, 0x0003 }, // J
+        { 0x0006, 0x0004, 0x0006 }, // K
+        { 0x0004, 0x0000, 0x0005 }, // L
+        { 0x0006, 0x0002, 0x0006 }, // M
+        { 0x0006, 0x0002, 0x0006 }, // N
+        { 0x0006, 0x0002, 0x0007 }, // O
+        { 0x0006, 0x0006, 0x0004 }, // P
+        { 0x0006, 0x0006, 0x0002 }, // Q
+        { 0x0000, 0x0004, 0x0004 }, // R
+        { 0x0006, 0x0004, 0x0003 }, // S
+        { 0x0004, 0x0004, 0x0005 }, // T
+        { 0x0004, 0x0002, 0x0007 }, // U
+        { 0x0004, 0x0002, 0x0007 }, // V
+        { 0x0004, 0x0002, 0x0007 }, // W
+        { 0x0004, 0x0006, 0x0007 }, // X
+        { 0x0004, 0x0006, 0x0003 }, // Y
+        { 0x0002, 0x0002, 0x0005 }, // Z
+        { 0x0006, 0x0000, 0x0005 }, // [
+        { 0x0004, 0x0000, 0x0002 }, // backslash
+        { 0x0002, 0x0002, 0x0003 }, // ]
+        { 0x0006, 0x0002, 0x0000 }, // ^
+        { 0x0000, 0x0000, 0x0001 }, // _
+        { 0x0000, 0x0002, 0x0000 }, // `
+        { 0x0002, 0x0006, 0x0007 }, // a
+        { 0x0004, 0x0004, 0x0007 }, // b
+        { 0x0000, 0x0004, 0x0005 }, // c
+        { 0x0000, 0x0006, 0x0007 }, // d
+        { 0x0006, 0x0006, 0x0005 }, // e
+        { 0x0006, 0x0004, 0x0004 }, // f
+        { 0x0006, 0x0006, 0x0003 }, // g
+        { 0x0004, 0x0004, 0x0006 }, // h
+        { 0x0000, 0x0000, 0x0004 }, // i
+        { 0x0000, 0x0002, 0x0003 }, // j
+        { 0x0006, 0x0004, 0x0006 }, // k
+        { 0x0004, 0x0000, 0x0004 }, // l
+        { 0x0006, 0x0002, 0x0006 }, // m
+        { 0x0000, 0x0004, 0x0006 }, // n
+        { 0x0000, 0x0004, 0x0007 }, // o
+        { 0x0006, 0x0006, 0x0004 }, // p
+        { 0x0006, 0x0006, 0x0002 }, // q
+        { 0x0000, 0x0004, 0x0004 }, // r
+        { 0x0006, 0x0004, 0x0003 }, // s
+        { 0x0004, 0x0004, 0x0005 }, // t
+        { 0x0000, 0x0000, 0x0007 }, // u
+        { 0x0000, 0x0000, 0x0007 }, // v
+        { 0x0004, 0x0002, 0x0007 }, // w
+        { 0x0004, 0x0006, 0x0007 }, // x
+        { 0x0004, 0x0006, 0x0003 }, // y
+        { 0x0002, 0x0002, 0x0005 }, // z
+        { 0x0000, 0x0002, 0x0006 }, // {
+        { 0x0004, 0x0002, 0x0006 }, // |
+        { 0x0004, 0x0000, 0x0006 }, // }
+        { 0x0002, 0x0000, 0x0000 }, // ~
+    },
+    { // Position 4
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0002, 0x0001 }, // !
+        { 0x0000, 0x0000, 0x0003 }, // "
+        { 0x0000, 0x0002, 0x0003 }, // #
+        { 0x0002, 0x0001, 0x0001 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0002, 0x0002, 0x0000 }, // &
+        { 0x0000, 0x0000, 0x0001 }, // '
+        { 0x0001, 0x0001, 0x0001 }, // (
+        { 0x0002, 0x0001, 0x0002 }, // )
+        { 0x0000, 0x0002, 0x0000 }, // *
+        { 0x0001, 0x0002, 0x0001 }, // +
+        { 0x0002, 0x0000, 0x0000 }, // ,
+        { 0x0000, 0x0002, 0x0000 }, // -
+        { 0x0000, 0x0002, 0x0000 }, // .
+        { 0x0001, 0x0000, 0x0002 }, // /
+        { 0x0003, 0x0001, 0x0003 }, // 0
+        { 0x0002, 0x0000, 0x0002 }, // 1
+        { 0x0001, 0x0003, 0x0002 }, // 2
+        { 0x0002, 0x0003, 0x0002 }, // 3
+        { 0x0002, 0x0002, 0x0003 }, // 4
+        { 0x0002, 0x0003, 0x0001 }, // 5
+        { 0x0003, 0x0003, 0x0001 }, // 6
+        { 0x0002, 0x0002, 0x0000 }, // 7
+        { 0x0003, 0x0003, 0x0003 }, // 8
+        { 0x0002, 0x0003, 0x0003 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0001, 0x0003, 0x0000 }, // <
+        { 0x0000, 0x0003, 0x0000 }, // =
+        { 0x0002, 0x0003, 0x0000 }, // >
+        { 0x0001, 0x0002, 0x0002 }, // ?
+        { 0x0003, 0x0003, 0x0003 }, // @
+        { 0x0003, 0x0003, 0x0002 }, // A
+        { 0x0003, 0x0003, 0x0003 }, // B
+        { 0x0001, 0x0001, 0x0001 }, // C
+        { 0x0003, 0x0001, 0x0003 }, // D
+        { 0x0001, 0x0003, 0x0001 }, // E
+        { 0x0001, 0x0002, 0x0001 }, // F
+        { 0x0003, 0x0001, 0x0001 }, // G
+        { 0x0003, 0x0002, 0x0003 }, // H
+        { 0x0001, 0x0000, 0x0001 }, // I
+        { 0x0000, 0x0002, 0x0002 }, // J
+        { 0x0003, 0x0002, 0x0001 }, // K
+        { 0x0000, 0x0002, 0x0001 }, // L
+        { 0x0003, 0x0002, 0x0000 }, // M
+        { 0x0003, 0x0002, 0x0000 }, // N
+        { 0x0003, 0x0001, 0x0003 }, // O
+        { 0x0001, 0x0002, 0x0003 }, // P
+        { 0x0002, 0x0002, 0x0003 }, // Q
+        { 0x0001, 0x0002, 0x0000 }, // R
+        { 0x0002, 0x0003, 0x0001 }, // S
+        { 0x0001, 0x0002, 0x0001 }, // T
+        { 0x0000, 0x0002, 0x0003 }, // U
+        { 0x0000, 0x0002, 0x0003 }, // V
+        { 0x0000, 0x0002, 0x0003 }, // W
+        { 0x0003, 0x0003, 0x0003 }, // X
+        { 0x0002, 0x0002, 0x0003 }, // Y
+        { 0x0001, 0x0001, 0x0002 }, // Z
+        { 0x0001, 0x0001, 0x0001 }, // [
+        { 0x0002, 0x0000, 0x0001 }, // backslash
+        { 0x0002, 0x0001, 0x0002 }, // ]
+        { 0x0000, 0x0000, 0x0003 }, // ^
+        { 0x0000, 0x0001, 0x0000 }, // _
+        { 0x0000, 0x0000, 0x0002 }, // `
+        { 0x0003, 0x0003, 0x0002 }, // a
+        { 0x0003, 0x0003, 0x0001 }, // b
+        { 0x0001, 0x0001, 0x0001 }, // c
+        { 0x0003, 0x0003, 0x0002 }, // d
+        { 0x0001, 0x0003, 0x0003 }, // e
+        { 0x0001, 0x0002, 0x0001 }, // f
+        { 0x0002, 0x0003, 0x0003 }, // g
+        { 0x0003, 0x0002, 0x0001 }, // h
+        { 0x0001, 0x0000, 0x0000 }, // i
+        { 0x0000, 0x0002, 0x0002 }, // j
+        { 0x0003, 0x0002, 0x0001 }, // k
+        { 0x0001, 0x0000, 0x0001 }, // l
+        { 0x0003, 0x0002, 0x0000 }, // m
+        { 0x0003, 0x0002, 0x0000 }, // n
+        { 0x0003, 0x0001, 0x0003 }, // o
+        { 0x0001, 0x0002, 0x0003 }, // p
+        { 0x0002, 0x0002, 0x0003 }, // q
+        { 0x0001, 0x0002, 0x0000 }, // r
+        { 0x0002, 0x0003, 0x0001 }, // s
+        { 0x0001, 0x0002, 0x0001 }, // t
+        { 0x0000, 0x0002, 0x0003 }, // u
+        { 0x0000, 0x0002, 0x0003 }, // v
+        { 0x0000, 0x0002, 0x0003 }, // w
+        { 0x0003, 0x0003, 0x0003 }, // x
+        { 0x0002, 0x0002, 0x0003 }, // y
+        { 0x0001, 0x0001, 0x0002 }, // z
+        { 0x0003, 0x0000, 0x0002 }, // {
+        { 0x0003, 0x0000, 0x0003 }, // |
+        { 0x0003, 0x0000, 0x0001 }, // }
+        { 0x0000, 0x0000, 0x0000 }, // ~
+    },
+    { // Position 5
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0009, 0x0000 }, // !
+        { 0x0000, 0x0001, 0x0010 }, // "
+        { 0x0000, 0x0009, 0x0018 }, // #
+        { 0x0010, 0x0011, 0x0008 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0000, 0x0018, 0x0000 }, // &
+        { 0x0000, 0x0001, 0x0000 }, // '
+        { 0x0018, 0x0001, 0x0008 }, // (
+        { 0x0010, 0x0010, 0x0018 }, // )
+        { 0x0000, 0x0008, 0x0000 }, // *
+        { 0x0008, 0x0009, 0x0000 }, // +
+        { 0x0000, 0x0010, 0x0000 }, // ,
+        { 0x0000, 0x0008, 0x0000 }, // -
+        { 0x0000, 0x0008, 0x0000 }, // .
+        { 0x0008, 0x0000, 0x0010 }, // /
+        { 0x0018, 0x0011, 0x0018 }, // 0
+        { 0x0000, 0x0010, 0x0010 }, // 1
+        { 0x0018, 0x0008, 0x0018 }, // 2
+        { 0x0010, 0x0018, 0x0018 }, // 3
+        { 0x0000, 0x0019, 0x0010 }, // 4
+        { 0x0010, 0x0019, 0x0008 }, // 5
+        { 0x0018, 0x0019, 0x0008 }, // 6
+        { 0x0000, 0x0010, 0x0018 }, // 7
+        { 0x0018, 0x0019, 0x0018 }, // 8
+        { 0x0010, 0x0019, 0x0018 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0018, 0x0008, 0x0000 }, // <
+        { 0x0010, 0x0008, 0x0000 }, // =
+        { 0x0010, 0x0018, 0x0000 }, // >
+        { 0x0008, 0x0008, 0x0018 }, // ?
+        { 0x0018, 0x0019, 0x0018 }, // @
+        { 0x0008, 0x0019, 0x0018 }, // A
+        { 0x0018, 0x0019, 0x0018 }, // B
+        { 0x0018, 0x0001, 0x0008 }, // C
+        { 0x0018, 0x0011, 0x0018 }, // D
+        { 0x0018, 0x0009, 0x0008 }, // E
+        { 0x0008, 0x0009, 0x0008 }, // F
+        { 0x0018, 0x0011, 0x0008 }, // G
+        { 0x0008, 0x0019, 0x0010 }, // H
+        { 0x0008, 0x0001, 0x0000 }, // I
+        { 0x0010, 0x0010, 0x0010 }, // J
+        { 0x0008, 0x0019, 0x0008 }, // K
+        { 0x0018, 0x0001, 0x0000 }, // L
+        { 0x0008, 0x0011, 0x0018 }, // M
+        { 0x0008, 0x0011, 0x0018 }, // N
+        { 0x0018, 0x0011, 0x0018 }, // O
+        { 0x0008, 0x0009, 0x0018 }, // P
+        { 0x0000, 0x0019, 0x0018 }, // Q
+        { 0x0008, 0x0008, 0x0000 }, // R
+        { 0x0010, 0x0019, 0x0008 }, // S
+        { 0x0018, 0x0009, 0x0000 }, // T
+        { 0x0018, 0x0011, 0x0010 }, // U
+        { 0x0018, 0x0011, 0x0010 }, // V
+        { 0x0018, 0x0011, 0x0010 }, // W
+        { 0x0018, 0x0019, 0x0010 }, // X
+        { 0x0010, 0x0019, 0x0010 }, // Y
+        { 0x0018, 0x0000, 0x0018 }, // Z
+        { 0x0018, 0x0001, 0x0008 }, // [
+        { 0x0000, 0x0011, 0x0000 }, // backslash
+        { 0x0010, 0x0010, 0x0018 }, // ]
+        { 0x0000, 0x0001, 0x0018 }, // ^
+        { 0x0010, 0x0000, 0x0000 }, // _
+        { 0x0000, 0x0000, 0x0010 }, // `
+        { 0x0018, 0x0018, 0x0018 }, // a
+        { 0x0018, 0x0019, 0x0000 }, // b
+        { 0x0018, 0x0008, 0x0000 }, // c
+        { 0x0018, 0x0018, 0x0010 }, // d
+        { 0x0018, 0x0009, 0x0018 }, // e
+        { 0x0008, 0x0009, 0x0008 }, // f
+        { 0x0010, 0x0019, 0x0018 }, // g
+        { 0x0008, 0x0019, 0x0000 }, // h
+        { 0x0008, 0x0000, 0x0000 }, // i
+        { 0x0010, 0x0010, 0x0010 }, // j
+        { 0x0008, 0x0019, 0x0008 }, // k
+        { 0x0008, 0x0001, 0x0000 }, // l
+        { 0x0008, 0x0011, 0x0018 }, // m
+        { 0x0008, 0x0018, 0x0000 }, // n
+        { 0x0018, 0x0018, 0x0000 }, // o
+        { 0x0008, 0x0009, 0x0018 }, // p
+        { 0x0000, 0x0019, 0x0018 }, // q
+        { 0x0008, 0x0008, 0x0000 }, // r
+        { 0x0010, 0x0019, 0x0008 }, // s
+        { 0x0018, 0x0009, 0x0000 }, // t
+        { 0x0018, 0x0010, 0x0000 }, // u
+        { 0x0018, 0x0010, 0x0000 }, // v
+        { 0x0018, 0x0011, 0x0010 }, // w
+        { 0x0018, 0x0019, 0x0010 }, // x
+        { 0x0010, 0x0019, 0x0010 }, // y
+        { 0x0018, 0x0000, 0x0018 }, // z
+        { 0x0008, 0x0010, 0x0010 }, // {
+        { 0x0008, 0x0011, 0x0010 }, // |
+        { 0x0008, 0x0011, 0x0000 }, // }
+        { 0x0000, 0x0000, 0x0008 }, // ~
+    },
+    { // Position 6
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0002, 0x0001 }, // !
+        { 0x0000, 0x0000, 0x0003 }, // "
+        { 0x0000, 0x0002, 0x0003 }, // #
+        { 0x0003, 0x0000, 0x0001 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0002, 0x0002, 0x0000 }, // &
+        { 0x0000, 0x0000, 0x0001 }, // '
+        { 0x0001, 0x0001, 0x0001 }, // (
+        { 0x0003, 0x0000, 0x0002 }, // )
+        { 0x0000, 0x0002, 0x0000 }, // *
+        { 0x0000, 0x0003, 0x0001 }, // +
+        { 0x0002, 0x0000, 0x0000 }, // ,
+        { 0x0000, 0x0002, 0x0000 }, // -
+        { 0x0000, 0x0002, 0x0000 }, // .
+        { 0x0000, 0x0001, 0x0002 }, // /
+        { 0x0003, 0x0001, 0x0003 }, // 0
+        { 0x0002, 0x0000, 0x0002 }, // 1
+        { 0x0001, 0x0003, 0x0002 }, // 2
+        { 0x0003, 0x0002, 0x0002 }, // 3
+        { 0x0002, 0x0002, 0x0003 }, // 4
+        { 0x0003, 0x0002, 0x0001 }, // 5
+        { 0x0003, 0x0003, 0x0001 }, // 6
+        { 0x0002, 0x0002, 0x0000 }, // 7
+        { 0x0003, 0x0003, 0x0003 }, // 8
+        { 0x0003, 0x0002, 0x0003 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0001, 0x0003, 0x0000 }, // <
+        { 0x0001, 0x0002, 0x0000 }, // =
+        { 0x0003, 0x0002, 0x0000 }, // >
+        { 0x0000, 0x0003, 0x0002 }, // ?
+        { 0x0003, 0x0003, 0x0003 }, // @
+        { 0x0003, 0x0003, 0x0002 }, // A
+        { 0x0003, 0x0003, 0x0003 }, // B
+        { 0x0001, 0x0001, 0x0001 }, // C
+        { 0x0003, 0x0001, 0x0003 }, // D
+        { 0x0001, 0x0003, 0x0001 }, // E
+        { 0x0000, 0x0003, 0x0001 }, // F
+        { 0x0003, 0x0001, 0x0001 }, // G
+        { 0x0002, 0x0003, 0x0003 }, // H
+        { 0x0000, 0x0001, 0x0001 }, // I
+        { 0x0000, 0x0002, 0x0002 }, // J
+        { 0x0002, 0x0003, 0x0001 }, // K
+        { 0x0000, 0x0002, 0x0001 }, // L
+        { 0x0002, 0x0003, 0x0000 }, // M
+        { 0x0002, 0x0003, 0x0000 }, // N
+        { 0x0003, 0x0001, 0x0003 }, // O
+        { 0x0000, 0x0003, 0x0003 }, // P
+        { 0x0002, 0x0002, 0x0003 }, // Q
+        { 0x0000, 0x0003, 0x0000 }, // R
+        { 0x0003, 0x0002, 0x0001 }, // S
+        { 0x0000, 0x0003, 0x0001 }, // T
+        { 0x0000, 0x0002, 0x0003 }, // U
+        { 0x0000, 0x0002, 0x0003 }, // V
+        { 0x0000, 0x0002, 0x0003 }, // W
+        { 0x0003, 0x0003, 0x0003 }, // X
+        { 0x0002, 0x0002, 0x0003 }, // Y
+        { 0x0001, 0x0001, 0x0002 }, // Z
+        { 0x0001, 0x0001, 0x0001 }, // [
+        { 0x0002, 0x0000, 0x0001 }, // backslash
+        { 0x0003, 0x0000, 0x0002 }, // ]
+        { 0x0000, 0x0000, 0x0003 }, // ^
+        { 0x0001, 0x0000, 0x0000 }, // _
+        { 0x0000, 0x0000, 0x0002 }, // `
+        { 0x0003, 0x0003, 0x0002 }, // a
+        { 0x0003, 0x0003, 0x0001 }, // b
+        { 0x0001, 0x0001, 0x0001 }, // c
+        { 0x0003, 0x0003, 0x0002 }, // d
+        { 0x0001, 0x0003, 0x0003 }, // e
+        { 0x0000, 0x0003, 0x0001 }, // f
+        { 0x0003, 0x0002, 0x0003 }, // g
+        { 0x0002, 0x0003, 0x0001 }, // h
+        { 0x0000, 0x0001, 0x0000 }, // i
+        { 0x0000, 0x0002, 0x0002 }, // j
+        { 0x0002, 0x0003, 0x0001 }, // k
+        { 0x0000, 0x0001, 0x0001 }, // l
+        { 0x0002, 0x0003, 0x0000 }, // m
+        { 0x0002, 0x0003, 0x0000 }, // n
+        { 0x0003, 0x0001, 0x0003 }, // o
+        { 0x0000, 0x0003, 0x0003 }, // p
+        { 0x0002, 0x0002, 0x0003 }, // q
+        { 0x0000, 0x0003, 0x0000 }, // r
+        { 0x0003, 0x0002, 0x0001 }, // s
+        { 0x0000, 0x0003, 0x0001 }, // t
+        { 0x0000, 0x0002, 0x0003 }, // u
+        { 0x0000, 0x0002, 0x0003 }, // v
+        { 0x0000, 0x0002, 0x0003 }, // w
+        { 0x0003, 0x0003, 0x0003 }, // x
+        { 0x0002, 0x0002, 0x0003 }, // y
+        { 0x0001, 0x0001, 0x0002 }, // z
+        { 0x0002, 0x0001, 0x0002 }, // {
+        { 0x0002, 0x0001, 0x0003 }, // |
+        { 0x0002, 0x0001, 0x0001 }, // }
+        { 0x0000, 0x0000, 0x0000 }, // ~
+    },
+    { // Position 7
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0002, 0x0001 }, // !
+        { 0x0000, 0x0000, 0x0401 }, // "
+        { 0x0000, 0x0002, 0x0403 }, // #
+        { 0x0003, 0x0000, 0x0003 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0002, 0x0002, 0x0000 }, // &
+        { 0x0000, 0x0000, 0x0001 }, // '
+        { 0x0001, 0x0001, 0x0003 }, // (
+        { 0x0003, 0x0000, 0x0402 }, // )
+        { 0x0000, 0x0002, 0x0000 }, // *
+        { 0x0000, 0x0003, 0x0001 }, // +
+        { 0x0002, 0x0000, 0x0000 }, // ,
+        { 0x0000, 0x0002, 0x0000 }, // -
+        { 0x0000, 0x0002, 0x0000 }, // .
+        { 0x0000, 0x0001, 0x0400 }, // /
+        { 0x0003, 0x0001, 0x0403 }, // 0
+        { 0x0002, 0x0000, 0x0400 }, // 1
+        { 0x0001, 0x0003, 0x0402 }, // 2
+        { 0x0003, 0x0002, 0x0402 }, // 3
+        { 0x0002, 0x0002, 0x0401 }, // 4
+        { 0x0003, 0x0002, 0x0003 }, // 5
+        { 0x0003, 0x0003, 0x0003 }, // 6
+        { 0x0002, 0x0000, 0x0402 }, // 7
+        { 0x0003, 0x0003, 0x0403 }, // 8
+        { 0x0003, 0x0002, 0x0403 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0001, 0x0003, 0x0000 }, // <
+        { 0x0001, 0x0002, 0x0000 }, // =
+        { 0x0003, 0x0002, 0x0000 }, // >
+        { 0x0000, 0x0003, 0x0402 }, // ?
+        { 0x0003, 0x0003, 0x0403 }, // @
+        { 0x0002, 0x0003, 0x0403 }, // A
+        { 0x0003, 0x0003, 0x0403 }, // B
+        { 0x0001, 0x0001, 0x0003 }, // C
+        { 0x0003, 0x0001, 0x0403 }, // D
+        { 0x0001, 0x0003, 0x0003 }, // E
+        { 0x0000, 0x0003, 0x0003 }, // F
+        { 0x0003, 0x0001, 0x0003 }, // G
+        { 0x0002, 0x0003, 0x0401 }, // H
+        { 0x0000, 0x0001, 0x0001 }, // I
+        { 0x0003, 0x0000, 0x0400 }, // J
+        { 0x0002, 0x0003, 0x0003 }, // K
+        { 0x0001, 0x0001, 0x0001 }, // L
+        { 0x0002, 0x0001, 0x0403 }, // M
+        { 0x0002, 0x0001, 0x0403 }, // N
+        { 0x0003, 0x0001, 0x0403 }, // O
+        { 0x0000, 0x0003, 0x0403 }, // P
+        { 0x0002, 0x0002, 0x0403 }, // Q
+        { 0x0000, 0x0003, 0x0000 }, // R
+        { 0x0003, 0x0002, 0x0003 }, // S
+        { 0x0001, 0x0003, 0x0001 }, // T
+        { 0x0003, 0x0001, 0x0401 }, // U
+        { 0x0003, 0x0001, 0x0401 }, // V
+        { 0x0003, 0x0001, 0x0401 }, // W
+        { 0x0003, 0x0003, 0x0401 }, // X
+        { 0x0003, 0x0002, 0x0401 }, // Y
+        { 0x0001, 0x0001, 0x0402 }, // Z
+        { 0x0001, 0x0001, 0x0003 }, // [
+        { 0x0002, 0x0000, 0x0001 }, // backslash
+        { 0x0003, 0x0000, 0x0402 }, // ]
+        { 0x0000, 0x0000, 0x0403 }, // ^
+        { 0x0001, 0x0000, 0x0000 }, // _
+        { 0x0000, 0x0000, 0x0400 }, // `
+        { 0x0003, 0x0003, 0x0402 }, // a
+        { 0x0003, 0x0003, 0x0001 }, // b
+        { 0x0001, 0x0003, 0x0000 }, // c
+        { 0x0003, 0x0003, 0x0400 }, // d
+        { 0x0001, 0x0003, 0x0403 }, // e
+        { 0x0000, 0x0003, 0x0003 }, // f
+        { 0x0003, 0x0002, 0x0403 }, // g
+        { 0x0002, 0x0003, 0x0001 }, // h
+        { 0x0000, 0x0001, 0x0000 }, // i
+        { 0x0003, 0x0000, 0x0400 }, // j
+        { 0x0002, 0x0003, 0x0003 }, // k
+        { 0x0000, 0x0001, 0x0001 }, // l
+        { 0x0002, 0x0001, 0x0403 }, // m
+        { 0x0002, 0x0003, 0x0000 }, // n
+        { 0x0003, 0x0003, 0x0000 }, // o
+        { 0x0000, 0x0003, 0x0403 }, // p
+        { 0x0002, 0x0002, 0x0403 }, // q
+        { 0x0000, 0x0003, 0x0000 }, // r
+        { 0x0003, 0x0002, 0x0003 }, // s
+        { 0x0001, 0x0003, 0x0001 }, // t
+        { 0x0003, 0x0001, 0x0000 }, // u
+        { 0x0003, 0x0001, 0x0000 }, // v
+        { 0x0003, 0x0001, 0x0401 }, // w
+        { 0x0003, 0x0003, 0x0401 }, // x
+        { 0x0003, 0x0002, 0x0401 }, // y
+        { 0x0001, 0x0001, 0x0402 }, // z
+        { 0x0002, 0x0001, 0x0400 }, // {
+        { 0x0002, 0x0001, 0x0401 }, // |
+        { 0x0002, 0x0001, 0x0001 }, // }
+        { 0x0000, 0x0000, 0x0002 }, // ~
+    },
+    { // Position 8
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0003, 0x0000 }, // !
+        { 0x0000, 0x0001, 0x0002 }, // "
+        { 0x0000, 0x0003, 0x0003 }, // #
+        { 0x0006, 0x0001, 0x0001 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0004, 0x0002, 0x0000 }, // &
+        { 0x0000, 0x0001, 0x0000 }, // '
+        { 0x0003, 0x0001, 0x0001 }, // (
+        { 0x0006, 0x0000, 0x0003 }, // )
+        { 0x0000, 0x0002, 0x0000 }, // *
+        { 0x0001, 0x0003, 0x0000 }, // +
+        { 0x0004, 0x0000, 0x0000 }, // ,
+        { 0x0000, 0x0002, 0x0000 }, // -
+        { 0x0000, 0x0002, 0x0000 }, // .
+        { 0x0001, 0x0000, 0x0002 }, // /
+        { 0x0007, 0x0001, 0x0003 }, // 0
+        { 0x0004, 0x0000, 0x0002 }, // 1
+        { 0x0003, 0x0002, 0x0003 }, // 2
+        { 0x0006, 0x0002, 0x0003 }, // 3
+        { 0x0004, 0x0003, 0x0002 }, // 4
+        { 0x0006, 0x0003, 0x0001 }, // 5
+        { 0x0007, 0x0003, 0x0001 }, // 6
+        { 0x0004, 0x0000, 0x0003 }, // 7
+        { 0x0007, 0x0003, 0x0003 }, // 8
+        { 0x0006, 0x0003, 0x0003 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0003, 0x0002, 0x0000 }, // <
+        { 0x0002, 0x0002, 0x0000 }, // =
+        { 0x0006, 0x0002, 0x0000 }, // >
+        { 0x0001, 0x0002, 0x0003 }, // ?
+        { 0x0007, 0x0003, 0x0003 }, // @
+        { 0x0005, 0x0003, 0x0003 }, // A
+        { 0x0007, 0x0003, 0x0003 }, // B
+        { 0x0003, 0x0001, 0x0001 }, // C
+        { 0x0007, 0x0001, 0x0003 }, // D
+        { 0x0003, 0x0003, 0x0001 }, // E
+        { 0x0001, 0x0003, 0x0001 }, // F
+        { 0x0007, 0x0001, 0x0001 }, // G
+        { 0x0005, 0x0003, 0x0002 }, // H
+        { 0x0001, 0x0001, 0x0000 }, // I
+        { 0x0006, 0x0000, 0x0002 }, // J
+        { 0x0005, 0x0003, 0x0001 }, // K
+        { 0x0003, 0x0001, 0x0000 }, // L
+        { 0x0005, 0x0001, 0x0003 }, // M
+        { 0x0005, 0x0001, 0x0003 }, // N
+        { 0x0007, 0x0001, 0x0003 }, // O
+        { 0x0001, 0x0003, 0x0003 }, // P
+        { 0x0004, 0x0003, 0x0003 }, // Q
+        { 0x0001, 0x0002, 0x0000 }, // R
+        { 0x0006, 0x0003, 0x0001 }, // S
+        { 0x0003, 0x0003, 0x0000 }, // T
+        { 0x0007, 0x0001, 0x0002 }, // U
+        { 0x0007, 0x0001, 0x0002 }, // V
+        { 0x0007, 0x0001, 0x0002 }, // W
+        { 0x0007, 0x0003, 0x0002 }, // X
+        { 0x0006, 0x0003, 0x0002 }, // Y
+        { 0x0003, 0x0000, 0x0003 }, // Z
+        { 0x0003, 0x0001, 0x0001 }, // [
+        { 0x0004, 0x0001, 0x0000 }, // backslash
+        { 0x0006, 0x0000, 0x0003 }, // ]
+        { 0x0000, 0x0001, 0x0003 }, // ^
+        { 0x0002, 0x0000, 0x0000 }, // _
+        { 0x0000, 0x0000, 0x0002 }, // `
+        { 0x0007, 0x0002, 0x0003 }, // a
+        { 0x0007, 0x0003, 0x0000 }, // b
+        { 0x0003, 0x0002, 0x0000 }, // c
+        { 0x0007, 0x0002, 0x0002 }, // d
+        { 0x0003, 0x0003, 0x0003 }, // e
+        { 0x0001, 0x0003, 0x0001 }, // f
+        { 0x0006, 0x0003, 0x0003 }, // g
+        { 0x0005, 0x0003, 0x0000 }, // h
+        { 0x0001, 0x0000, 0x0000 }, // i
+        { 0x0006, 0x0000, 0x0002 }, // j
+        { 0x0005, 0x0003, 0x0001 }, // k
+        { 0x0001, 0x0001, 0x0000 }, // l
+        { 0x0005, 0x0001, 0x0003 }, // m
+        { 0x0005, 0x0002, 0x0000 }, // n
+        { 0x0007, 0x0002, 0x0000 }, // o
+        { 0x0001, 0x0003, 0x0003 }, // p
+        { 0x0004, 0x0003, 0x0003 }, // q
+        { 0x0001, 0x0002, 0x0000 }, // r
+        { 0x0006, 0x0003, 0x0001 }, // s
+        { 0x0003, 0x0003, 0x0000 }, // t
+        { 0x0007, 0x0000, 0x0000 }, // u
+        { 0x0007, 0x0000, 0x0000 }, // v
+        { 0x0007, 0x0001, 0x0002 }, // w
+        { 0x0007, 0x0003, 0x0002 }, // x
+        { 0x0006, 0x0003, 0x0002 }, // y
+        { 0x0003, 0x0000, 0x0003 }, // z
+        { 0x0005, 0x0000, 0x0002 }, // {
+        { 0x0005, 0x0001, 0x0002 }, // |
+        { 0x0005, 0x0001, 0x0000 }, // }
+        { 0x0000, 0x0000, 0x0001 }, // ~
+    },
+    { // Position 9
+        { 0x0000, 0x0000, 0x0000 }, // space
+        { 0x0000, 0x0003, 0x0000 }, // !
+        { 0x0000, 0x0001, 0x0002 }, // "
+        { 0x0000, 0x0003, 0x0003 }, // #
+        { 0x0004, 0x0005, 0x0001 }, // $
+        { 0x0000, 0x0000, 0x0000 }, // %
+        { 0x0000, 0x0006, 0x0000 }, // &
+        { 0x0000, 0x0001, 0x0000 }, // '
+        { 0x0006, 0x0001, 0x0001 }, // (
+        { 0x0004, 0x0004, 0x0003 }, // )
+        { 0x0000, 0x0002, 0x0000 }, // *
+        { 0x0002, 0x0003, 0x0000 }, // +
+        { 0x0000, 0x0004, 0x0000 }, // ,
+        { 0x0000, 0x0002, 0x0000 }, // -
+        { 0x0000, 0x0002, 0x0000 }, // .
+        { 0x0002, 0x0000, 0x0002 }, // /
+        { 0x0006, 0x0005, 0x0003 }, // 0
+        { 0x0000, 0x0004, 0x0002 }, // 1
+        { 0x0006, 0x0002, 0x0003 }, // 2
+        { 0x0004, 0x0006, 0x0003 }, // 3
+        { 0x0000, 0x0007, 0x0002 }, // 4
+        { 0x0004, 0x0007, 0x0001 }, // 5
+        { 0x0006, 0x0007, 0x0001 }, // 6
+        { 0x0000, 0x0004, 0x0003 }, // 7
+        { 0x0006, 0x0007, 0x0003 }, // 8
+        { 0x0004, 0x0007, 0x0003 }, // 9
+        { 0x0000, 0x0000, 0x0000 }, // :
+        { 0x0000, 0x0000, 0x0000 }, // ;
+        { 0x0006, 0x0002, 0x0000 }, // <
+        { 0x0004, 0x0002, 0x0000 }, // =
+        { 0x0004, 0x0006, 0x0000 }, // >
+        { 0x0002, 0x0002, 0x0003 }, // ?
+        { 0x0006, 0x0007, 0x0003 }, // @
+        { 0x0002, 0x0007, 0x0003 }, // A
+        { 0x0006, 0x0007, 0x0003 }, // B
+        { 0x0006, 0x0001, 0x0001 }, // C
+        { 0x0006, 0x0005, 0x0003 }, // D
+        { 0x0006, 0x0003, 0x0001 }, // E
+        { 0x0002, 0x0003, 0x0001 }, // F
+        { 0x0006, 0x0005, 0x0001 }, // G
+        { 0x0002, 0x0007, 0x0002 }, // H
+        { 0x0002, 0x0001, 0x0000 }, // I
+        { 0x0004, 0x0004, 0x0002 }, // J
+        { 0x0002, 0x0007, 0x0001 }, // K
+        { 0x0006, 0x0001, 0x0000 }, // L
+        { 0x0002, 0x0005, 0x0003 }, // M
+        { 0x0002, 0x0005, 0x0003 }, // N
+        { 0x0006, 0x0005, 0x0003 }, // O
+        { 0x0002, 0x0003, 0x0003 }, // P
+        { 0x0000, 0x0007, 0x0003 }, // Q
+        { 0x0002, 0x0002, 0x0000 }, // R
+        { 0x0004, 0x0007, 0x0001 }, // S
+        { 0x0006, 0x0003, 0x0000 }, // T
+        { 0x0006, 0x0005, 0x0002 }, // U
+        { 0x0006, 0x0005, 0x0002 }, // V
+        { 0x0006, 0x0005, 0x0002 }, // W
+        { 0x0006, 0x0007, 0x0002 }, // X
+        { 0x0004, 0x0007, 0x0002 }, // Y
+        { 0x0006, 0x0000, 0x0003 }, // Z
+        { 0x0006, 0x0001, 0x0001 }, // [
+        { 0x0000, 0x0005, 0x0000 }, // backslash
+        { 0x0004, 0x0004, 0x0003 }, // ]
+        { 0x0000, 0x0001, 0x0003 }, // ^
+        { 0x0004, 0x0000, 0x0000 }, // _
+        { 0x0000, 0x0000, 0x0002 }, // `
+        { 0x0006, 0x0006, 0x0003 }, // a
+        { 0x0006, 0x0007, 0x0000 }, // b
+        { 0x0006, 0x0002, 0x0000 }, // c
+        { 0x0006, 0x0006, 0x0002 }, // d
+        { 0x0006, 0x0003, 0x0003 }, // e
+        { 0x0002, 0x0003, 0x0001 }, // f
+        { 0x0004, 0x0007, 0x0003 }, // g
+        { 0x0002, 0x0007, 0x0000 }, // h
+        { 0x0002, 0x0000, 0x0000 }, // i
+        { 0x0004, 0x0004, 0x0002 }, // j
+        { 0x0002, 0x0007, 0x0001 }, // k
+        { 0x0002, 0x0001, 0x0000 }, // l
+        { 0x0002, 0x0005, 0x0003 }, // m
+        { 0x0002, 0x0006, 0x0000 }, // n
+        { 0x0006, 0x0006, 0x0000 }, // o
+        { 0x0002, 0x0003, 0x0003 }, // p
+        { 0x0000, 0x0007, 0x0003 }, // q
+        { 0x0002, 0x0002, 0x0000 }, // r
+        { 0x0004, 0x0007, 0x0001 }, // s
+        { 0x0006, 0x0003, 0x0000 }, // t
+        { 0x0006, 0x0004, 0x0000 }, // u
+        { 0x0006, 0x0004, 0x0000 }, // v
+        { 0x0006, 0x0005, 0x0002 }, // w
+        { 0x0006, 0x0007, 0x0002 }, // x
+        { 0x0004, 0x0007, 0x0002 }, // y
+        { 0x0006, 0x0000, 0x0003 }, // z
+        { 0x0002, 0x0004, 0x0002 }, // {
+        { 0x0002, 0x0005, 0x0002 }, // |
+        { 0x0002, 0x0005, 0x0000 }, // }
+        { 0x0000, 0x0000, 0x0001 }, // ~
+    },
+};
+
+#endif
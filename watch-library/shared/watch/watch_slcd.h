@@ -41,6 +41,29 @@
   */
 /// @{
 
+/// Counters for the work the display driver has done, for profiling.
+typedef struct {
+    uint32_t commits;               // calls to watch_display_commit, i.e. frames
+    uint32_t register_writes;       // segment data registers those commits wrote
+    uint32_t characters_drawn;      // characters whose segments were stored
+    uint32_t characters_skipped;    // characters skipped because their position already showed them
+} watch_display_stats_t;
+
+/// The most frames watch_display_start_sequence and watch_display_start_minute_sequence will take.
+#define WATCH_DISPLAY_MAX_SEQUENCE_FRAMES 16
+
+/// How watch_display_uint and friends fill out a field that's wider than the number in it.
+typedef enum {
+    WATCH_DISPLAY_PAD_SPACE = 0,    ///< Right-aligned, with blanks in front, like printf's %4d.
+    WATCH_DISPLAY_PAD_ZERO,         ///< Right-aligned, with zeros in front, like printf's %04d.
+    WATCH_DISPLAY_PAD_LEFT,         ///< Left-aligned, with blanks after, like printf's %-4d.
+} watch_display_pad_t;
+
+/// The contents of the whole display, as the segment data for COM0-2. See watch_display_capture_frame.
+typedef struct {
+    uint32_t com[3];
+} watch_display_frame_t;
+
 /// An enum listing the icons and indicators available on the watch.
 typedef enum WatchIndicatorSegment {
     WATCH_INDICATOR_SIGNAL = 0, ///< The hourly signal indicator; also useful for indicating that sensors are on.
@@ -73,6 +96,26 @@ void watch_clear_pixel(uint8_t com, uint8_t seg);
   */
 void watch_clear_display(void);
 
+/** @brief Writes any changes to the display out to the Segment LCD.
+  * @details The pixel, character, string and indicator functions draw into a copy of the display in RAM,
+  *          and nothing appears on the LCD until it is committed. This way a redraw costs at most one
+  *          register write per COM line, no matter how many segments it touched. The watch library
+  *          commits for you after every call to app_loop, before entering sleep mode and before playing a
+  *          note on the buzzer. If you draw something and then block in delay_ms, call this first, or the
+  *          LCD won't show it until the delay is over.
+  */
+void watch_display_commit(void);
+
+/** @brief Returns how many frames have been committed, and how much drawing they took, since boot or the last reset.
+  * @details watch_display_string remembers the character it last drew in each position and skips any that
+  *          haven't changed, so a face that redraws all ten characters every second mostly costs nothing.
+  *          The skipped count shows how much of that is going on.
+  */
+watch_display_stats_t watch_display_get_stats(void);
+
+/// Resets the counters returned by watch_display_get_stats.
+void watch_display_reset_stats(void);
+
 /** @brief Displays a string at the given position, starting from the top left. There are ten digits.
            A space in any position will clear that digit.
   * @param string A null-terminated string.
@@ -84,6 +127,45 @@ void watch_clear_display(void);
   */
 void watch_display_string(char *string, uint8_t position);
 
+/** @brief Displays an unsigned integer in a field of the given width, without going through printf.
+  * @details This is the cheap way to put a number on the display: no format string, no varargs and no
+  *          buffer, and the digits are worked out by multiplying rather than dividing, which matters on a
+  *          Cortex-M0+ with no hardware divide. A number too long for its field loses its leading digits, so
+  *          12345 in a field of three shows as "345".
+  * @param value The number to display.
+  * @param position The position of the field's first (leftmost) character.
+  * @param width The width of the field, in characters.
+  * @param pad How to fill out the rest of the field. @see watch_display_pad_t
+  */
+void watch_display_uint(uint32_t value, uint8_t position, uint8_t width, watch_display_pad_t pad);
+
+/** @brief Displays a signed integer in a field of the given width; like watch_display_uint, but with a minus
+  *        sign for negative numbers. With WATCH_DISPLAY_PAD_ZERO the sign goes first, as in "-042".
+  * @details A negative number too long for its field keeps its sign in the first place and loses leading
+  *          digits after it, so -12345 in a field of three shows as "-45". In a field of one, it shows as "-".
+  */
+void watch_display_int(int32_t value, uint8_t position, uint8_t width, watch_display_pad_t pad);
+
+/** @brief Displays a fixed-point number with a decimal point, like printf's %4.1f but for an integer.
+  * @details For example, a temperature kept in tenths of a degree, 215, displays as "21.5" with places = 1.
+  *          There is always at least one digit before the point, unless the number is too long for its
+  *          field; then it loses leading digits the way watch_display_int does, keeping any minus sign.
+  * @param value The number to display, scaled up by 10 to the power of places.
+  * @param places How many of its digits go after the decimal point.
+  * @param position The position of the field's first character.
+  * @param width The width of the field, in characters, counting the point and any minus sign.
+  * @param pad How to fill out the rest of the field. @see watch_display_pad_t
+  */
+void watch_display_fixed(int32_t value, uint8_t places, uint8_t position, uint8_t width, watch_display_pad_t pad);
+
+/** @brief Displays a time of day in positions 4-9 as HHMMSS, the way the stock clock faces do.
+  * @param hour The hour, padded with a blank unless leading_zero is set.
+  * @param minute The minute, always two digits.
+  * @param second The second, always two digits.
+  * @param leading_zero true to pad a single-digit hour with a zero rather than a blank.
+  */
+void watch_display_time(uint8_t hour, uint8_t minute, uint8_t second, bool leading_zero);
+
 /** @brief Turns the colon segment on.
   */
 void watch_set_colon(void);
@@ -147,5 +229,50 @@ bool watch_tick_animation_is_running(void);
   * @details This will stop the animation and clear all segments in position 8.
   */
 void watch_stop_tick_animation(void);
+
+/** @brief Copies what has been drawn so far into a frame, for use in a sequence.
+  * @details To build a sequence, draw each frame as usual with watch_display_string and friends, and capture
+  *          it before drawing the next. Nothing needs to be committed for this.
+  * @param frame The frame to fill in.
+  */
+void watch_display_capture_frame(watch_display_frame_t *frame);
+
+/** @brief Has the SLCD step through a sequence of frames on its own, looping back to the first at the end.
+  * @details The first frame goes up right away, and each one after it once the duration has passed. The SLCD's
+  *          frame counter times the steps and the DMA controller writes the frames out, so this does not require
+  *          any CPU resources, and will continue in STANDBY and Sleep mode (but not Deep Sleep mode, since that
+  *          mode turns off the LCD). The frames are copied, so they need not outlive the call.
+  *          While a sequence is running, the display belongs to it: nothing you draw is committed until you
+  *          call watch_display_stop_sequence, after which drawing carries on from whichever frame was showing.
+  * @param frames The frames to show; see watch_display_capture_frame.
+  * @param num_frames The number of frames, up to WATCH_DISPLAY_MAX_SEQUENCE_FRAMES. A single frame simply goes up.
+  * @param duration How long to show each frame in milliseconds, from 50 to ~4250 ms.
+  * @note This replaces anything else on the display, including a blinking character or the tick animation, once
+  *       the second frame goes up.
+  */
+void watch_display_start_sequence(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration);
+
+/** @brief Has the SLCD step through a sequence of frames on its own, one per minute.
+  * @details Works like watch_display_start_sequence, except that the steps come at the top of each minute, so
+  *          that a clock can show the next several minutes without waking up for each of them. The RTC alarm
+  *          times the steps, which means the sequence takes over the alarm: any alarm callback is disabled, and
+  *          has to be registered again after the sequence is done. The sequence stops on the last frame, and
+  *          calls the callback (from an interrupt, which wakes the watch from STANDBY) once it goes up.
+  * @param frames The frames to show, one for each minute starting with the current one.
+  * @param num_frames The number of frames, up to WATCH_DISPLAY_MAX_SEQUENCE_FRAMES. A single frame simply goes up,
+  *                   and neither takes the alarm nor calls the callback.
+  * @param callback The function to call when the last frame goes up, or NULL.
+  */
+void watch_display_start_minute_sequence(const watch_display_frame_t *frames, uint8_t num_frames, ext_irq_cb_t callback);
+
+/** @brief Checks if a sequence is currently running.
+  * @return true if the SLCD is stepping through a sequence; false otherwise.
+  */
+bool watch_display_sequence_is_running(void);
+
+/** @brief Stops the running sequence, leaving whichever frame it was showing on the display.
+  * @details If the sequence ran on the RTC alarm, register your alarm callback again afterwards.
+  */
+void watch_display_stop_sequence(void);
 /// @}
 #endif
@@ -36,8 +36,12 @@
 static bool sleeping = true;
 static volatile long animation_frame_id = ANIMATION_FRAME_ID_INVALID;
 
+// a delay can't block the page, so delay_ms returns right away and moves this forward instead: it's the wall
+// clock time at which the firmware's delays run out. the display and buzzer play back what was done during a
+// delay at the moment it would have happened, and the main loop doesn't run again until the delays are over.
+static double busy_until;
+
 // make compiler happy
-static void main_loop_set_sleeping(bool sleeping);
 static EM_BOOL main_loop(double time, void *userData);
 
 static inline void request_next_frame(void) {
@@ -48,20 +52,29 @@ static inline void request_next_frame(void) {
 
 static EM_BOOL main_loop(double time, void *userData) {
     if (main_loop_is_sleeping()) {
+        animation_frame_id = ANIMATION_FRAME_ID_INVALID;
         request_next_frame();
         return EM_FALSE;
     }
 
     if (sleeping) {
         sleeping = false;
+        _watch_perf_did_wake();
         app_wake_from_standby();
     }
 
     animation_frame_id = ANIMATION_FRAME_ID_INVALID;
+    double started = emscripten_get_now();
     bool can_sleep = app_loop();
+    watch_display_commit();
+    _watch_display_trace_frame();
+    EM_ASM({
+        if (typeof recordFrameTime === 'function') recordFrameTime($0);
+    }, emscripten_get_now() - started);
 
     if (can_sleep) {
         app_prepare_for_standby();
+        _watch_perf_will_sleep();
         sleeping = true;
         animation_frame_id = ANIMATION_FRAME_ID_INVALID;
         return EM_FALSE;
@@ -77,6 +90,15 @@ void resume_main_loop(void) {
     }
 }
 
+void main_loop_run_pending(void) {
+    // run a frame that was asked for but not drawn yet right away, so that a burst of events doesn't get
+    // folded into one pass through app_loop.
+    if (!ANIMATION_FRAME_ID_IS_VALID(animation_frame_id) || main_loop_is_sleeping()) return;
+    emscripten_cancel_animation_frame(animation_frame_id);
+    animation_frame_id = ANIMATION_FRAME_ID_INVALID;
+    main_loop(emscripten_get_now(), NULL);
+}
+
 void suspend_main_loop(void) {
     if (ANIMATION_FRAME_ID_IS_VALID(animation_frame_id)) {
         emscripten_cancel_animation_frame(animation_frame_id);
@@ -85,28 +107,42 @@ void suspend_main_loop(void) {
     animation_frame_id = ANIMATION_FRAME_ID_SUSPENDED;
 }
 
+double main_loop_get_busy_time(void) {
+    double now = emscripten_get_now();
+    return busy_until > now ? busy_until - now : 0;
+}
+
 void main_loop_sleep(uint32_t ms) {
-    main_loop_set_sleeping(true);
-    emscripten_sleep(ms);
-    main_loop_set_sleeping(false);
-    animation_frame_id = ANIMATION_FRAME_ID_INVALID;
+    busy_until = emscripten_get_now() + main_loop_get_busy_time() + ms;
 }
 
 bool main_loop_is_sleeping(void) {
-    return EM_ASM_INT({ return Module['suspended']; }) != 0;
+    return main_loop_get_busy_time() > 0;
 }
 
-static void main_loop_set_sleeping(bool sleeping) {
+void main_loop_trace(const char *line) {
     EM_ASM({
-        Module['suspended'] = $0;
-    }, sleeping);
+        if (typeof recordTrace === 'function') recordTrace($0, UTF8ToString($1));
+    }, watch_rtc_get_virtual_time(), line);
+}
+
+void main_loop_end_trace(void) {
+    char line[32];
+    snprintf(line, sizeof(line), "end wakes %lu", (unsigned long)watch_perf_get_stats().wakes);
+    main_loop_trace(line);
 }
 
 void delay_ms(const uint16_t ms) {
+    _watch_display_trace_frame();
     main_loop_sleep(ms);
 }
 
 int main(void) {
+    // a trace starts at boot, so that replaying it starts from the same state.
+    EM_ASM({
+        if (typeof beginTrace === 'function') beginTrace($0);
+    }, watch_rtc_get_virtual_time());
+
     app_init();
     _watch_init();
     app_setup();
@@ -125,12 +125,14 @@ void watch_disable_buzzer(void) {
     buzzer_enabled = false;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
 
+    // notes played during a delay are still scheduled; let them finish.
     EM_ASM({
-        if (Module['audioContext']) {
-            Module['audioContext'].close();
+        const audioContext = Module['audioContext'];
+        if (audioContext) {
+            setTimeout(() => audioContext.close(), $0);
             Module['audioContext'] = null;
         }
-    });
+    }, main_loop_get_busy_time());
 }
 
 void watch_set_buzzer_on(void) {
@@ -144,6 +146,7 @@ void watch_set_buzzer_on(void) {
             const oscillator = audioContext.createOscillator();
             const gain = audioContext.createGain();
             oscillator.type = 'triangle';
+            gain.gain.value = 0;
             oscillator.connect(gain);
             gain.connect(audioContext.destination);
             oscillator.start(0);
@@ -152,9 +155,11 @@ void watch_set_buzzer_on(void) {
             audioContext._gain = gain;
         }
 
-        audioContext._oscillator.frequency.value = 1e6/$0;
-        audioContext._gain.gain.value = volumeGain;
-    }, buzzer_period);
+        // during a delay, the note starts when the delay would have ended.
+        const when = audioContext.currentTime + $1 / 1000;
+        audioContext._oscillator.frequency.setValueAtTime(1e6/$0, when);
+        audioContext._gain.gain.setValueAtTime(volumeGain, when);
+    }, buzzer_period, main_loop_get_busy_time());
 }
 
 void watch_set_buzzer_off(void) {
@@ -163,9 +168,9 @@ void watch_set_buzzer_off(void) {
     EM_ASM({
         const audioContext = Module['audioContext'];
         if (audioContext && audioContext._gain) {
-            audioContext._gain.gain.value = 0;
+            audioContext._gain.gain.setValueAtTime(0, audioContext.currentTime + $0 / 1000);
         }
-    });
+    }, main_loop_get_busy_time());
 }
 
 void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
@@ -176,6 +181,8 @@ void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
         watch_set_buzzer_on();
     }
 
+    // anything drawn before the note is meant to be seen while it plays.
+    watch_display_commit();
     main_loop_sleep(duration_ms);
     watch_set_buzzer_off();
 }
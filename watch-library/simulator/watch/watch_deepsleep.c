@@ -61,6 +61,9 @@ uint32_t watch_get_backup_data(uint8_t reg) {
 }
 
 void watch_enter_sleep_mode(void) {
+    // make sure the display shows whatever the app last drew; it won't get another chance until we wake.
+    watch_display_commit();
+
     // TODO: (a2) hook to UI
 
     // enter standby (4); we basically hang out here until an interrupt wakes us.
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#include <stdio.h>
 #include <string.h>
 
 #include "watch_extint.h"
@@ -181,11 +182,15 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, watch_in
         $1 ? classList.add(highlight) : classList.remove(highlight);
     }, button_id, level);
 
-    if (!external_interrupt_enabled || main_loop_is_sleeping()) {
+    if (!external_interrupt_enabled) {
         return EM_FALSE;
     }
 
     watch_set_pin_level(pin, level);
+    char line[16];
+    snprintf(line, sizeof(line), "%s %s", level ? "down" : "up",
+             button_id == BTN_ID_MODE ? "mode" : button_id == BTN_ID_LIGHT ? "light" : "alarm");
+    main_loop_trace(line);
 
     if (callback && (event & trigger) != 0) {
         callback();
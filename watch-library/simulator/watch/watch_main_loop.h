@@ -28,8 +28,31 @@ void suspend_main_loop(void);
 
 void resume_main_loop(void);
 
+void main_loop_run_pending(void);
+
+// delays without blocking: the firmware carries on, but the main loop waits, and the display and buzzer play
+// what happens next as if the delay had blocked.
 void main_loop_sleep(uint32_t ms);
 
+// returns true while a delay is running.
 bool main_loop_is_sleeping(void);
 
+// returns how many milliseconds of delay are still to run; what the firmware does now happens that far ahead.
+double main_loop_get_busy_time(void);
+
 void delay_ms(const uint16_t ms);
+
+// sets how many seconds of virtual time pass per second of real time; 0 runs as fast as possible.
+void watch_rtc_set_virtual_speed(double speed);
+
+// returns the virtual clock, in milliseconds on JavaScript's Date timeline.
+double watch_rtc_get_virtual_time(void);
+
+// adds a line to the trace being recorded, if any, stamped with the virtual time; see shell.html.
+void main_loop_trace(const char *line);
+
+// ends the trace being recorded with the wake count, so that a replay can compare against it.
+void main_loop_end_trace(void);
+
+// traces the frame the firmware has drawn, if it changed since the last one.
+void _watch_display_trace_frame(void);
@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_perf.h"
+
+#include <emscripten.h>
+
+static uint32_t awake_since;
+static uint64_t awake_us;
+static uint32_t wakes;
+
+uint32_t watch_perf_get_us(void) {
+    // count from the first reading, the way SysTick counts from reset on the watch.
+    static double epoch = -1;
+    double now = emscripten_get_now();
+    if (epoch < 0) epoch = now;
+
+    return (uint32_t)(uint64_t)((now - epoch) * 1000.0);
+}
+
+watch_perf_stats_t watch_perf_get_stats(void) {
+    watch_perf_stats_t stats;
+    stats.wakes = wakes;
+    stats.awake_us = awake_us + (uint32_t)(watch_perf_get_us() - awake_since);
+
+    return stats;
+}
+
+void watch_perf_reset_stats(void) {
+    wakes = 0;
+    awake_us = 0;
+    awake_since = watch_perf_get_us();
+}
+
+void _watch_perf_will_sleep(void) {
+    awake_us += (uint32_t)(watch_perf_get_us() - awake_since);
+}
+
+void _watch_perf_did_wake(void) {
+    wakes++;
+    awake_since = watch_perf_get_us();
+}
@@ -22,18 +22,34 @@
  * SOFTWARE.
  */
 
+#include <math.h>
 #include "watch_rtc.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
-static double time_offset = 0;
-static long tick_callbacks[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
-
-static long alarm_interval_id = -1;
-static long alarm_timeout_id = -1;
-static double alarm_interval;
+// the simulator keeps its own virtual clock, in milliseconds on JavaScript's Date timeline. it runs at some
+// multiple of real time, or with a speed of 0, skips straight from each RTC event to the next one. either way,
+// the periodic callbacks, the alarm and watch_rtc_get_date_time all read the same clock.
+static bool clock_started = false;
+static double speed = 1;
+static double virtual_anchor;
+static double wall_anchor;
+static bool dispatching = false;
+static double dispatch_time;
+static long timer_id = -1;
+
+// at high speeds, don't let the page stall for longer than this while catching up on events.
+#define WATCH_RTC_MAX_BATCH_MS 10
+
+static ext_irq_cb_t tick_callbacks[8];
+static uint8_t periodic_enabled;
+static double periodic_due[8];
+
+static double alarm_due = INFINITY;
+static watch_date_time alarm_time;
+static watch_rtc_alarm_match alarm_mask;
 ext_irq_cb_t alarm_callback;
 ext_irq_cb_t btn_alarm_callback;
 ext_irq_cb_t a2_callback;
@@ -46,30 +62,170 @@ bool _watch_rtc_is_enabled(void) {
 void _watch_rtc_init(void) {
 }
 
+static void _watch_rtc_anchor(double virtual_time) {
+    virtual_anchor = virtual_time;
+    wall_anchor = emscripten_get_now();
+}
+
+static void _watch_rtc_start_clock(void) {
+    if (clock_started) return;
+    clock_started = true;
+    // like the RTC counter, start on a whole second.
+    _watch_rtc_anchor(EM_ASM_DOUBLE({ return Math.floor(Date.now() / 1000) * 1000; }));
+}
+
+static double _watch_rtc_next_event(void) {
+    double next = alarm_due;
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        if ((periodic_enabled & (1 << per_n)) && periodic_due[per_n] < next) next = periodic_due[per_n];
+    }
+    return next;
+}
+
+static double _watch_rtc_unclamped_now(void) {
+    _watch_rtc_start_clock();
+    if (speed == 0) return virtual_anchor;
+    return virtual_anchor + (emscripten_get_now() - wall_anchor) * speed;
+}
+
+static double _watch_rtc_now(void) {
+    if (dispatching) return dispatch_time;
+    // if the events have fallen behind the clock, the clock waits for them.
+    double now = _watch_rtc_unclamped_now();
+    double next = _watch_rtc_next_event();
+    return now < next ? now : next;
+}
+
+static double _watch_rtc_period(uint8_t per_n) {
+    // PERn fires at (128 >> n) Hz: PER0 at 128 Hz, PER7 at 1 Hz.
+    return 1000.0 / (128 >> per_n);
+}
+
+static double _watch_rtc_next_alarm(double after) {
+    if (alarm_mask == ALARM_MATCH_DISABLED) return INFINITY;
+    return EM_ASM_DOUBLE({
+        const hour = ($1 >> 12) & 0x1f;
+        const minute = ($1 >> 6) & 0x3f;
+        const second = $1 & 0x3f;
+
+        // the alarm fires as the clock ticks over to a matching second.
+        const date = new Date(Math.floor($0 / 1000) * 1000 + 1000);
+        for (let i = 0; i < 60 && date.getSeconds() != second; i++) date.setTime(date.getTime() + 1000);
+        if ($2 >= 2) { // MMSS
+            for (let i = 0; i < 60 && date.getMinutes() != minute; i++) date.setTime(date.getTime() + 60 * 1000);
+        }
+        if ($2 >= 3) { // HHMMSS; a day with a DST change can be 25 hours long.
+            for (let i = 0; i < 25 && date.getHours() != hour; i++) date.setTime(date.getTime() + 60 * 60 * 1000);
+        }
+        return date.getTime();
+    }, after, alarm_time.reg, alarm_mask);
+}
+
+static void _watch_rtc_dispatch(double time) {
+    dispatching = true;
+    dispatch_time = time;
+    if (speed == 0) virtual_anchor = time;
+
+    // as in RTC_Handler, handle the periodic callbacks first, starting from PER7, the 1 Hz tick.
+    for (int8_t per_n = 7; per_n >= 0; per_n--) {
+        if ((periodic_enabled & (1 << per_n)) && periodic_due[per_n] == time) {
+            periodic_due[per_n] += _watch_rtc_period(per_n);
+            if (tick_callbacks[per_n] != NULL) tick_callbacks[per_n]();
+        }
+    }
+
+    if (alarm_due == time) {
+        alarm_due = _watch_rtc_next_alarm(time);
+        if (alarm_callback != NULL) alarm_callback();
+    }
+
+    dispatching = false;
+    resume_main_loop();
+}
+
+static void _watch_rtc_schedule(void);
+
+static void _watch_rtc_run(void *userData) {
+    (void) userData;
+    timer_id = -1;
+
+    double started = emscripten_get_now();
+    bool caught_up = false;
+    while (!main_loop_is_sleeping() && emscripten_get_now() - started < WATCH_RTC_MAX_BATCH_MS) {
+        double next = _watch_rtc_next_event();
+        if (next == INFINITY || (speed > 0 && next > _watch_rtc_unclamped_now())) {
+            caught_up = true;
+            break;
+        }
+        _watch_rtc_dispatch(next);
+        // give the main loop a pass after every event, just as the watch would wake for every interrupt.
+        main_loop_run_pending();
+    }
+
+    // if the events can't keep up with the requested speed, slow the clock down rather than drop any of them.
+    if (!caught_up && speed > 0) _watch_rtc_anchor(_watch_rtc_now());
+
+    _watch_rtc_schedule();
+}
+
+static void _watch_rtc_schedule(void) {
+    if (timer_id != -1) {
+        emscripten_clear_timeout(timer_id);
+        timer_id = -1;
+    }
+
+    double next = _watch_rtc_next_event();
+    if (next == INFINITY) return;
+
+    double timeout = 0;
+    if (speed > 0) timeout = fmax(0, (next - _watch_rtc_unclamped_now()) / speed);
+    timer_id = emscripten_set_timeout(_watch_rtc_run, timeout, NULL);
+}
+
+double watch_rtc_get_virtual_time(void) {
+    return _watch_rtc_now();
+}
+
+void watch_rtc_set_virtual_speed(double new_speed) {
+    if (new_speed < 0) return;
+    _watch_rtc_anchor(_watch_rtc_now());
+    speed = new_speed;
+    _watch_rtc_schedule();
+}
+
 void watch_rtc_set_date_time(watch_date_time date_time) {
-    time_offset = EM_ASM_DOUBLE({
+    // like the real RTC, setting the clock does not reset the prescaler, so the subsecond phase is preserved.
+    double now = _watch_rtc_now();
+    double time = EM_ASM_DOUBLE({
         const year = 2020 + (($0 >> 26) & 0x3f);
         const month = ($0 >> 22) & 0xf;
         const day = ($0 >> 17) & 0x1f;
         const hour = ($0 >> 12) & 0x1f;
         const minute = ($0 >> 6) & 0x3f;
         const second = $0 & 0x3f;
-        const date = new Date(year, month - 1, day, hour, minute, second);
-        return date - Date.now();
-    }, date_time.reg);
+        return new Date(year, month - 1, day, hour, minute, second).getTime();
+    }, date_time.reg) + fmod(now, 1000);
+
+    _watch_rtc_anchor(time);
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        double period = _watch_rtc_period(per_n);
+        periodic_due[per_n] = (floor(time / period) + 1) * period;
+    }
+    alarm_due = _watch_rtc_next_alarm(time);
+    _watch_rtc_schedule();
 }
 
 watch_date_time watch_rtc_get_date_time(void) {
     watch_date_time retval;
     retval.reg = EM_ASM_INT({
-        const date = new Date(Date.now() + $0);
+        const date = new Date($0);
         return date.getSeconds() |
             (date.getMinutes() << 6) |
             (date.getHours() << 12) |
             (date.getDate() << 17) |
             ((date.getMonth() + 1) << 22) |
             ((date.getFullYear() - 2020) << 26);
-    }, time_offset);
+    }, _watch_rtc_now());
     return retval;
 }
 
@@ -81,12 +237,6 @@ void watch_rtc_disable_tick_callback(void) {
     watch_rtc_disable_periodic_callback(1);
 }
 
-static void watch_invoke_periodic_callback(void *userData) {
-    ext_irq_cb_t callback = userData;
-    callback();
-    resume_main_loop();
-}
-
 void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
     // we told them, it has to be a power of 2.
     if (__builtin_popcount(frequency) != 1) return;
@@ -97,104 +247,43 @@ void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequen
     // 0x01 (1 Hz) will have 7 leading zeros for PER7. 0xF0 (128 Hz) will have no leading zeroes for PER0.
     uint8_t per_n = __builtin_clz(tmp);
 
-    double interval = 1000.0 / frequency; // in msec
-
-    if (tick_callbacks[per_n] != -1) emscripten_clear_interval(tick_callbacks[per_n]);
-    tick_callbacks[per_n] = emscripten_set_interval(watch_invoke_periodic_callback, interval, (void *)callback);
+    if (!(periodic_enabled & (1 << per_n))) {
+        double period = _watch_rtc_period(per_n);
+        periodic_due[per_n] = (floor(_watch_rtc_now() / period) + 1) * period;
+    }
+    tick_callbacks[per_n] = callback;
+    periodic_enabled |= 1 << per_n;
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
     uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
-    if (tick_callbacks[per_n] != -1) {
-        emscripten_clear_interval(tick_callbacks[per_n]);
-        tick_callbacks[per_n] = -1;
-    }
+    watch_rtc_disable_matching_periodic_callbacks(1 << per_n);
 }
 
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
-    for (int i = 0; i < 8; i++) {
-        if (tick_callbacks[i] != -1 && (mask & (1 << i)) != 0) {
-            emscripten_clear_interval(tick_callbacks[i]);
-            tick_callbacks[i] = -1;
-        }
-    }
+    periodic_enabled &= ~mask;
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_disable_all_periodic_callbacks(void) {
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 }
 
-static void watch_invoke_alarm_interval_callback(void *userData) {
-    if (alarm_callback) alarm_callback();
-}
-
-static void watch_invoke_alarm_callback(void *userData) {
-    if (alarm_callback) alarm_callback();
-    alarm_interval_id = emscripten_set_interval(watch_invoke_alarm_interval_callback, alarm_interval, NULL);
-}
-
-void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time alarm_time, watch_rtc_alarm_match mask) {
-    watch_rtc_disable_alarm_callback();
-
-    switch (mask) {
-        case ALARM_MATCH_DISABLED:
-            return;
-        case ALARM_MATCH_SS:
-            alarm_interval = 60 * 1000;
-            break;
-        case ALARM_MATCH_MMSS:
-            alarm_interval = 60 * 60 * 1000;
-            break;
-        case ALARM_MATCH_HHMMSS:
-            alarm_interval = 60 * 60 * 60 * 1000;
-            break;
-    }
-
-    double timeout = EM_ASM_DOUBLE({
-        const now = Date.now();
-        const date = new Date(now + $0);
-
-        const hour = ($1 >> 12) & 0x1f;
-        const minute = ($1 >> 6) & 0x3f;
-        const second = $1 & 0x3f;
-
-        if ($2 == 1) { // SS
-            if (second < date.getSeconds()) date.setMinutes(date.getMinutes() + 1);
-            date.setSeconds(second);
-        } else if ($2 == 2) { // MMSS
-            if (second < date.getSeconds()) date.setMinutes(date.getMinutes() + 1);
-            if (minute < date.getMinutes()) date.setHours(date.getHours() + 1);
-            date.setMinutes(minute, second);
-        } else if ($2 == 3) { // HHMMSS
-            if (second < date.getSeconds()) date.setMinutes(date.getMinutes() + 1);
-            if (minute < date.getMinutes()) date.setHours(date.getHours() + 1);
-            if (hour < date.getHours()) date.setDate(date.getDate() + 1);
-            date.setHours(hour, minute, second);
-        } else {
-            throw 'Invalid alarm match mask';
-        }
-
-        return date - now;
-    }, time_offset, alarm_time.reg, mask);
-
+void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time time, watch_rtc_alarm_match mask) {
     alarm_callback = callback;
-    alarm_timeout_id = emscripten_set_timeout(watch_invoke_alarm_callback, timeout, NULL);
+    alarm_time = time;
+    alarm_mask = mask;
+    alarm_due = _watch_rtc_next_alarm(_watch_rtc_now());
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_disable_alarm_callback(void) {
     alarm_callback = NULL;
-    alarm_interval = 0;
-
-    if (alarm_timeout_id != -1) {
-        emscripten_clear_timeout(alarm_timeout_id);
-        alarm_timeout_id = -1;
-    }
-
-    if (alarm_interval_id != -1) {
-        emscripten_clear_interval(alarm_interval_id);
-        alarm_interval_id = -1;
-    }
+    alarm_mask = ALARM_MATCH_DISABLED;
+    alarm_due = INFINITY;
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_enable(bool en)
@@ -22,9 +22,13 @@
  * SOFTWARE.
  */
 
+#include <stdio.h>
+#include <string.h>
+
 #include "watch_slcd.h"
 #include "watch_private_display.h"
 #include "hpl_slcd_config.h"
+#include "watch_main_loop.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -38,35 +42,137 @@ static long blink_interval_id = - 1;
 static bool tick_state;
 static long tick_interval_id = -1;
 
+// the SDATAL0-2 registers, one word per COM line, and what the page is showing. Commits only update the
+// registers; the page catches up once per animation frame, touching only the segments that changed.
+static uint32_t segment_data[3];
+static uint32_t segment_shown[3];
+
+// frames drawn during a delay, waiting for the wall clock to reach the moment they would have appeared.
+#define DISPLAY_QUEUE_LENGTH 32
+typedef struct {
+    double time;
+    uint32_t com[3];
+} queued_frame_t;
+static queued_frame_t display_queue[DISPLAY_QUEUE_LENGTH];
+static uint8_t display_queue_head;
+static uint8_t display_queue_count;
+// the last frame written to the trace.
+static uint32_t segment_traced[3] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+static long flush_frame_id = -1;
+
+// the running sequence, if any. a minute sequence steps on the RTC alarm, so it follows the virtual clock.
+static const watch_display_frame_t *sequence_frames;
+static uint8_t sequence_length;
+static uint8_t sequence_frame;
+static bool sequence_every_minute;
+static long sequence_interval_id = -1;
+
+static EM_BOOL _watch_display_flush(double time, void *userData) {
+    flush_frame_id = -1;
+    double started = emscripten_get_now();
+
+    // show the last frame that's come due; with nothing queued, that's whatever the registers hold.
+    const uint32_t *visible = segment_data;
+    while (display_queue_count > 0 && display_queue[display_queue_head].time <= started) {
+        visible = display_queue[display_queue_head].com;
+        display_queue_head = (display_queue_head + 1) % DISPLAY_QUEUE_LENGTH;
+        display_queue_count--;
+    }
+    if (display_queue_count > 0) {
+        if (visible == segment_data) visible = segment_shown;
+        flush_frame_id = emscripten_request_animation_frame(_watch_display_flush, NULL);
+    }
+
+    for (uint8_t com = 0; com < 3; com++) {
+        uint32_t changed = visible[com] ^ segment_shown[com];
+        if (!changed) continue;
+        uint32_t value = visible[com];
+        segment_shown[com] = value;
+        EM_ASM({
+            // look the segment elements up once, indexed by COM and segment pin; both skins share them.
+            if (!Module['segmentElements']) {
+                var cache = [];
+                document.querySelectorAll("[data-com][data-seg]").forEach((e) => {
+                    var com = +e.dataset.com, seg = +e.dataset.seg;
+                    cache[com] = cache[com] || [];
+                    (cache[com][seg] = cache[com][seg] || []).push(e);
+                });
+                Module['segmentElements'] = cache;
+            }
+            var elements = Module['segmentElements'][$0] || [];
+            for (var seg = 0, changed = $1 >>> 0; changed; seg++, changed >>>= 1) {
+                if ((changed & 1) && elements[seg]) {
+                    var opacity = ($2 >>> seg) & 1;
+                    elements[seg].forEach((e) => e.style.opacity = opacity);
+                }
+            }
+        }, com, changed, value);
+    }
+
+    EM_ASM({
+        if (typeof recordDisplayFlush === 'function') recordDisplayFlush($0);
+    }, emscripten_get_now() - started);
+
+    return EM_FALSE;
+}
+
 void watch_enable_display(void) {
+    // we don't know what the page is showing yet, so the first flush sets every segment.
+    segment_data[0] = 0;
+    segment_data[1] = 0;
+    segment_data[2] = 0;
+    segment_shown[0] = UINT32_MAX;
+    segment_shown[1] = UINT32_MAX;
+    segment_shown[2] = UINT32_MAX;
+    if (flush_frame_id == -1) flush_frame_id = emscripten_request_animation_frame(_watch_display_flush, NULL);
     watch_clear_display();
+    _watch_display_invalidate();
 }
 
-void watch_set_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 1);
-    }, com, seg);
+static void _watch_display_queue_frame(double time) {
+    queued_frame_t *last = NULL;
+    if (display_queue_count > 0) last = &display_queue[(display_queue_head + display_queue_count - 1) % DISPLAY_QUEUE_LENGTH];
+    if (last == NULL || last->time != time) {
+        // if the firmware draws faster than the queue drains, skip the oldest frame.
+        if (display_queue_count == DISPLAY_QUEUE_LENGTH) {
+            display_queue_head = (display_queue_head + 1) % DISPLAY_QUEUE_LENGTH;
+            display_queue_count--;
+        }
+        last = &display_queue[(display_queue_head + display_queue_count) % DISPLAY_QUEUE_LENGTH];
+        last->time = time;
+        display_queue_count++;
+    }
+    memcpy(last->com, segment_data, sizeof(segment_data));
 }
 
-void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 0);
-    }, com, seg);
+void _watch_display_write_com(uint8_t com, uint32_t value) {
+    segment_data[com] = value;
+    // during a delay, or while frames from one are still waiting, this frame waits its turn.
+    double busy = main_loop_get_busy_time();
+    if (busy > 0 || display_queue_count > 0) _watch_display_queue_frame(emscripten_get_now() + busy);
+    if (flush_frame_id == -1) flush_frame_id = emscripten_request_animation_frame(_watch_display_flush, NULL);
 }
 
-void watch_clear_display(void) {
-    EM_ASM({
-        document.querySelectorAll("[data-com][data-seg]")
-            .forEach((e) => e.style.opacity = 0);
-    });
+uint32_t _watch_display_read_com(uint8_t com) {
+    return segment_data[com];
+}
+
+void _watch_display_trace_frame(void) {
+    // blink and tick animations run on wall clock time, so only what the firmware draws is traced.
+    if (memcmp(segment_data, segment_traced, sizeof(segment_data)) == 0) return;
+    memcpy(segment_traced, segment_data, sizeof(segment_data));
+
+    char line[48];
+    snprintf(line, sizeof(line), "frame %08lx %08lx %08lx",
+             (unsigned long)segment_data[0], (unsigned long)segment_data[1], (unsigned long)segment_data[2]);
+    main_loop_trace(line);
 }
 
 static void watch_invoke_blink_callback(void *userData) {
     blink_state = !blink_state;
     watch_display_character(blink_state ? blink_character : ' ', 7);
     watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    watch_display_commit();
 }
 
 void watch_start_character_blink(char character, uint32_t duration) {
@@ -94,6 +200,7 @@ static void watch_invoke_tick_callback(void *userData) {
         watch_clear_pixel(0, 3);
         watch_set_pixel(0, 2);
     }
+    watch_display_commit();
 }
 
 void watch_start_tick_animation(uint32_t duration) {
@@ -115,3 +222,44 @@ void watch_stop_tick_animation(void) {
 
     watch_display_character(' ', 8);
 }
+
+static void watch_invoke_sequence_callback(void *userData) {
+    sequence_frame = (sequence_frame + 1) % sequence_length;
+    for (uint8_t com = 0; com < 3; com++) _watch_display_write_com(com, sequence_frames[sequence_frame].com[com]);
+    _watch_display_trace_frame();
+
+    if (sequence_every_minute && sequence_frame == sequence_length - 1) {
+        // on the watch, this is the DMA controller's interrupt.
+        _watch_display_stop_sequence_clock();
+        _watch_display_sequence_did_finish();
+        resume_main_loop();
+    }
+}
+
+static void watch_invoke_sequence_alarm_callback(void) {
+    watch_invoke_sequence_callback(NULL);
+}
+
+void _watch_display_start_sequence_clock(const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration) {
+    sequence_frames = frames;
+    sequence_length = num_frames;
+    sequence_frame = 0;
+    sequence_every_minute = duration == 0;
+    if (sequence_every_minute) {
+        // on the watch, the sequence steps on the alarm's event output, so it has the alarm to itself.
+        watch_date_time top_of_minute = { .reg = 0 };
+        watch_rtc_register_alarm_callback(watch_invoke_sequence_alarm_callback, top_of_minute, ALARM_MATCH_SS);
+    } else {
+        sequence_interval_id = emscripten_set_interval(watch_invoke_sequence_callback, (double)duration, NULL);
+    }
+}
+
+void _watch_display_stop_sequence_clock(void) {
+    if (sequence_every_minute) {
+        watch_rtc_disable_alarm_callback();
+        sequence_every_minute = false;
+    } else {
+        emscripten_clear_interval(sequence_interval_id);
+        sequence_interval_id = -1;
+    }
+}